@@ -12,6 +12,7 @@
 
 #include <wx/wxfreechartdefs.h>
 #include <wx/dataset.h>
+#include <wx/axis/axistransform.h>
 
 #include <wx/dynarray.h>
 
@@ -47,6 +48,14 @@ public:
      * @param axis axis that bounds are changed
      */
     virtual void BoundsChanged(Axis *axis) = 0;
+
+    /**
+     * Called when axis is being destroyed, so observers, that do not
+     * own axis, can forget it. Observer must not be removed from axis here.
+     * Default implementation does nothing.
+     * @param axis destroyed axis
+     */
+    virtual void AxisDestroyed(Axis *axis);
 };
 
 /**
@@ -296,6 +305,14 @@ public:
      */
     virtual bool IsVisible(double value);
 
+    /**
+     * Returns range of visible data values, values in this range
+     * are visible as checked by IsVisible.
+     * @param minValue out for minimal visible value
+     * @param maxValue out for maximal visible value
+     */
+    virtual void GetVisibleBounds(double &minValue, double &maxValue);
+
     /**
      * Returns nearest boundary value.
      * @param value out of bounds value, for which will be returned boundary value
@@ -313,6 +330,16 @@ public:
      */
     virtual wxCoord ToGraphics(wxDC &dc, int minCoord, int gRange, double value);
 
+    /**
+     * Returns transform from data space to graphics space for current axis
+     * bounds, window and margins. Transform is valid until axis is changed,
+     * so renderers get it once per draw and translate values in batches.
+     * @param minCoord minimal graphics space coordinate
+     * @param gRange graphics space range
+     * @return transform
+     */
+    virtual AxisTransform GetTransform(int minCoord, int gRange);
+
     /**
      * Transforms coordinate from graphics space to data space.
      * @param dc device context
@@ -352,6 +379,14 @@ protected:
      */
     virtual bool AcceptDataset(Dataset *dataset) = 0;
 
+    /**
+     * Returns linear transform for current axis bounds, window and margins.
+     * @param minCoord minimal graphics space coordinate
+     * @param gRange graphics space range
+     * @return transform
+     */
+    AxisTransform GetLinearTransform(int minCoord, int gRange);
+
     DatasetArray m_datasets;
 	wxPen m_majorGridlinePen;
 	wxPen m_minorGridlinePen;
@@ -365,6 +400,7 @@ protected:
 
     FIRE_WITH_THIS(AxisChanged);
     FIRE_WITH_THIS(BoundsChanged);
+    FIRE_WITH_THIS(AxisDestroyed);
 
 private:
     AXIS_LOCATION m_location;
@@ -401,10 +437,14 @@ public:
 
     virtual bool IsVisible(double value);
 
+    virtual void GetVisibleBounds(double &minValue, double &maxValue);
+
     virtual double BoundValue(double value);
 
     virtual wxCoord ToGraphics(wxDC &dc, int minCoord, int gRange, double value);
 
+    virtual AxisTransform GetTransform(int minCoord, int gRange);
+
     virtual double ToData(wxDC &dc, int minCoord, int gRange, wxCoord g);
 
     //virtual bool UpdateBounds() ;
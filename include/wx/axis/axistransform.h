@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    axistransform.h
+// Purpose: data to graphics coordinates transform declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef AXISTRANSFORM_H_
+#define AXISTRANSFORM_H_
+
+#include <wx/wxfreechartdefs.h>
+
+#include <math.h>
+
+// graphics coordinates are clamped to this range, so
+// out of range values do not overflow wxCoord
+#define AXIS_TRANSFORM_COORD_LIMIT 1.0e9
+
+/**
+ * Function to map value before affine transform.
+ * @param value value in data space
+ * @param userData user data passed to AxisTransform::SetValueMap
+ * @return mapped value
+ */
+typedef double (*AxisValueMap)(double value, void *userData);
+
+/**
+ * Immutable transform from axis data space to graphics space.
+ * Transform is calculated by Axis::GetTransform from axis bounds, window
+ * and margins once per draw, so translating value costs one multiply and add
+ * (and logarithm for logarithmic axes) instead of virtual calls and bounds
+ * lookups. Values can be translated in batches, which uses SIMD instructions
+ * when they are enabled at compile time (SSE2 or AVX), including
+ * vectorized base 2 logarithm for logarithmic transforms.
+ */
+class WXDLLIMPEXP_FREECHART AxisTransform
+{
+public:
+    /**
+     * Constructs transform, that maps all values to zero.
+     */
+    AxisTransform();
+
+    /**
+     * Constructs linear transform.
+     * @param minCoord minimal graphics space coordinate
+     * @param gRange graphics space range
+     * @param minValue data value mapped to minCoord (or to minCoord + gRange for vertical)
+     * @param maxValue data value mapped to minCoord + gRange (or to minCoord for vertical)
+     * @param vertical true for vertical axis, where greater values are upper
+     */
+    AxisTransform(int minCoord, int gRange, double minValue, double maxValue, bool vertical);
+
+    /**
+     * Constructs logarithmic transform.
+     * @param minCoord minimal graphics space coordinate
+     * @param gRange graphics space range
+     * @param minValue data value mapped to minCoord, must be positive
+     * @param maxValue data value mapped to minCoord + gRange, must be positive
+     * @param vertical true for vertical axis
+     * @return transform
+     */
+    static AxisTransform Log(int minCoord, int gRange, double minValue, double maxValue, bool vertical);
+
+    /**
+     * Sets function to map values before transform, for axes
+     * with nonlinear scale, such as CompDateAxis.
+     * @param map map function
+     * @param userData data passed to map function
+     */
+    void SetValueMap(AxisValueMap map, void *userData);
+
+    /**
+     * Transforms value from data space to graphics space.
+     * @param value value in data space
+     * @return coordinate in graphics space
+     */
+    wxCoord ToGraphics(double value) const
+    {
+        if (m_map != NULL) {
+            value = m_map(value, m_mapData);
+        }
+        if (m_log) {
+            value = Log2(value);
+        }
+        return ToCoord(value * m_scale + m_offset);
+    }
+
+    /**
+     * Transforms values from data space to graphics space.
+     * @param values values in data space
+     * @param coords output coordinates in graphics space
+     * @param count value count
+     */
+    void ToGraphics(const double *values, wxCoord *coords, size_t count) const;
+
+    /**
+     * Transforms coordinate from graphics space to data space.
+     * Value map set by SetValueMap is not inverted.
+     * @param g coordinate in graphics space
+     * @return value in data space
+     */
+    double ToData(wxCoord g) const;
+
+    /**
+     * Calculates base 2 logarithm, same way as batch ToGraphics does,
+     * so single and batch transforms give same coordinates.
+     * Not positive values give NaN, which is mapped outside of plot.
+     * @param value value
+     * @return base 2 logarithm of value
+     */
+    static double Log2(double value);
+
+    bool IsLog() const
+    {
+        return m_log;
+    }
+
+    bool HasValueMap() const
+    {
+        return m_map != NULL;
+    }
+
+    double GetScale() const
+    {
+        return m_scale;
+    }
+
+    double GetOffset() const
+    {
+        return m_offset;
+    }
+
+private:
+    static wxCoord ToCoord(double g)
+    {
+        // comparisons are written so NaN goes to lower limit
+        g = (g > -AXIS_TRANSFORM_COORD_LIMIT) ? g : -AXIS_TRANSFORM_COORD_LIMIT;
+        g = (g < AXIS_TRANSFORM_COORD_LIMIT) ? g : AXIS_TRANSFORM_COORD_LIMIT;
+        return (wxCoord) g;
+    }
+
+    void Init(int minCoord, int gRange, double minValue, double maxValue, bool vertical);
+
+    double m_scale;
+    double m_offset;
+    bool m_log;
+
+    AxisValueMap m_map;
+    void *m_mapData;
+};
+
+#endif /* AXISTRANSFORM_H_ */
@@ -14,6 +14,7 @@
 #include <wx/areadraw.h>
 
 #include <wx/dynarray.h>
+#include <wx/vector.h>
 
 WX_DECLARE_USER_EXPORTED_OBJARRAY(wxDateSpan, wxDateSpanArray, WXDLLIMPEXP_FREECHART);
 WX_DECLARE_USER_EXPORTED_OBJARRAY(wxTimeSpan, wxTimeSpanArray, WXDLLIMPEXP_FREECHART);
@@ -22,6 +23,8 @@ WX_DECLARE_USER_EXPORTED_OBJARRAY(wxTimeSpan, wxTimeSpanArray, WXDLLIMPEXP_FREEC
  * Composite date axis.
  * Draws multiple date/time spans (like day, week, month, year),
  * instead of just label as DateAxis does.
+ * Spans are counted with calendar arithmetic on day numbers, and span
+ * cells (bounds and labels) are cached until axis bounds or window change.
  */
 class WXDLLIMPEXP_FREECHART CompDateAxis : public Axis
 {
@@ -42,6 +45,8 @@ public:
 
     virtual wxCoord ToGraphics(wxDC &dc, int minCoord, int gRange, double value);
 
+    virtual AxisTransform GetTransform(int minCoord, int gRange);
+
     virtual double ToData(wxDC &dc, int minCoord, int gRange, wxCoord g);
 
     /**
@@ -66,20 +71,41 @@ protected:
     virtual bool AcceptDataset(Dataset *dataset);
 
 private:
-    void DrawSpan(wxDC &dc, wxRect rcAxis, int spanNum, wxString spanLabel, double start, double end);
+    /**
+     * Cached span, drawn on axis.
+     */
+    struct SpanCell
+    {
+        double start;
+        double end;
+        wxString label;
+    };
+
+    typedef wxVector<SpanCell> SpanRow;
+
+    void DrawSpan(wxDC &dc, wxRect rcAxis, int spanNum, const wxString &spanLabel, double start, double end);
 
     wxString GetSpanLabel(wxDateTime date, wxDateSpan span);
 
     wxCoord GetSpanExtent(wxDC &dc);
 
-    bool GetWindowDateBounds(wxDateTime &date0, wxDateTime &date1);
+    /**
+     * Calculates span cells for visible window, if they are not calculated yet.
+     */
+    void UpdateSpanLayout();
 
-    double DateToDataCoord(wxDateTime &date);
+    /**
+     * Calculates first and last dates of axis, if they are not calculated yet.
+     * @return false if axis has no dataset, dates or spans
+     */
+    bool UpdateDateRange();
 
-    bool GetFirstDate(wxDateTime &date);
-    bool GetLastDate(wxDateTime &date);
+    double DateToDataCoord(time_t date);
 
-    bool GetFirstLastDate(wxDateTime &firstDate, wxDateTime &lastDate);
+    /**
+     * Maps dataset date index to data coordinate, used as transform value map.
+     */
+    static double MapDateIndex(double value, void *axis);
 
     bool GetMinSpan(wxDateSpan &span);
 
@@ -95,6 +121,18 @@ private:
     AreaDraw *m_spanDraw;
 
     wxDateSpanArray m_dateSpans;
+
+    // axis date range: first date rounded to minimal span and last date
+    bool m_dateRangeValid;
+    long m_firstDay; // day number of first date
+    time_t m_firstDate;
+    time_t m_lastDate;
+
+    // span cells for each span, valid for window
+    wxVector<SpanRow> m_spanLayout;
+    bool m_spanLayoutValid;
+    double m_layoutWinMin;
+    double m_layoutWinMax;
 };
 
 #endif /* COMPDATEAXIS_H_ */
@@ -12,9 +12,14 @@
 
 #include <wx/axis/labelaxis.h>
 
+#include <wx/vector.h>
+
 
 /**
  * An axis for displaying date/time values.
+ * Labels are placed on calendar boundaries (seconds, minutes, hours, days,
+ * months or years), so about ten labels are shown for visible window
+ * regardless of date count. Dates of dataset must be in ascending order.
  * TODO:
  * - works with only one dataset.
  */
@@ -34,6 +39,7 @@ public:
     void SetDateFormat(const wxString &dateFormat)
     {
         m_dateFormat = dateFormat;
+        InvalidateTicks();
         FireAxisChanged();
     }
 
@@ -53,9 +59,17 @@ protected:
 
     virtual wxSize GetLongestLabelExtent(wxDC &dc);
 
+    virtual void PrepareTicks();
+
 private:
     size_t m_dateCount;
 
+    // indexes of dates, where ticks are placed, valid for visible window
+    wxVector<size_t> m_tickIndexes;
+    bool m_tickIndexesValid;
+    double m_tickWinMin;
+    double m_tickWinMax;
+
     wxString m_dateFormat;
 };
 
@@ -11,6 +11,9 @@
 #define LABELAXIS_H_
 
 #include <wx/axis/axis.h>
+#include <wx/drawutils.h>
+
+#include <wx/vector.h>
 
 /**
  * Class that used to implement labels with different colours.
@@ -151,6 +154,7 @@ public:
     void SetLabelTextFont(wxFont labelTextFont)
     {
         m_labelTextFont = labelTextFont;
+        InvalidateTicks();
         FireAxisChanged();
     }
 
@@ -204,6 +208,7 @@ public:
     void SetMinorIntervalCount(size_t count)
     {
         m_minorIntervalCount = count;
+        InvalidateTicks();
         FireAxisChanged();
     }
 
@@ -275,14 +280,67 @@ protected:
 
     virtual bool HasLabels();
 
+    /**
+     * Drops cached ticks. Ticks values, labels and extents are cached
+     * until data bounds change, so derivative classes must call this
+     * function, when values or labels change without bounds change
+     * (eg. when label format is changed).
+     */
+    void InvalidateTicks()
+    {
+        m_ticksValid = false;
+    }
+
+    /**
+     * Called before cached ticks are used. Derivative classes, which ticks
+     * depend on something other than data bounds (eg. axis window), can
+     * check it here and call InvalidateTicks.
+     */
+    virtual void PrepareTicks();
+
 private:
+    /**
+     * Cached axis tick.
+     */
+    struct Tick
+    {
+        double value;
+        wxString label; // empty for minor ticks
+        wxSize extent;
+        bool isMajor;
+    };
+
+    /**
+     * Graphics coordinates of visible ticks,
+     * calculated for graphics range and axis window.
+     */
+    struct TickCoords
+    {
+        bool valid;
+        int minCoord;
+        int gRange;
+        double visibleMin;
+        double visibleMax;
+        wxCoord marginMin;
+        wxCoord marginMax;
+
+        wxVector<size_t> ticks; // indexes of visible ticks
+        wxVector<wxCoord> coords;
+    };
+
+    void UpdateTicks();
+
+    void MeasureTicks(wxDC &dc);
+
+    void UpdateTickCoords(TickCoords &tickCoords, int minCoord, int gRange);
+
     void DrawLabels(wxDC &dc, wxRect rc);
 
-    void DrawLabel(wxDC &dc, wxRect rc, const wxString &label, double value, bool isMajorLabel);
+    void DrawLabel(wxDC &dc, wxRect rc, const Tick &tick, wxCoord coord);
 
     void DrawBorderLine(wxDC &dc, wxRect rc);
     
-    void DrawGridLine(wxDC& dc, const wxRect& rc, double value);
+    void DrawGridLine(wxDC& dc, const wxRect& rc, wxCoord coord);
 
     wxCoord m_labelLineSize;
     wxCoord m_labelGap;
@@ -305,6 +363,20 @@ private:
     int m_blankLabels;
 
     LabelColourer *m_labelColourer;
+
+    // tick cache, valid for data bounds
+    wxVector<Tick> m_ticks;
+    bool m_ticksValid;
+    double m_ticksMinValue;
+    double m_ticksMaxValue;
+
+    // labels extents are valid for font and device context resolution
+    bool m_tickExtentsValid;
+    TextMeasureKey m_tickExtentsKey;
+    wxSize m_longestLabelExtent;
+
+    TickCoords m_labelCoords;
+    TickCoords m_gridCoords;
 };
 
 #endif /*LABELAXIS_H_*/
@@ -12,6 +12,8 @@
 
 #include <wx/axis/numberaxis.h>
 
+#include <wx/vector.h>
+
 /**
  * An axis for displaying and logarithmically scaling numerical data.
  */
@@ -42,6 +44,11 @@ public:
      */
     virtual wxCoord ToGraphics(wxDC &dc, int minCoord, int gRange, double value);
 
+    /**
+     * Overwrites Axis::GetTransform to get logarithmic scaling.
+     */
+    virtual AxisTransform GetTransform(int minCoord, int gRange);
+
     /**
      * Overwrites Axis::ToData to invert logarithmic scaling.
      */
@@ -55,9 +62,44 @@ protected:
   double GetMaxValue(Dataset* dataset);
 
 private:
+    /**
+     * Returns logarithms of bounds. Logarithms are cached
+     * until bounds or logarithmic base are changed.
+     * @param minValue minimal value
+     * @param maxValue maximal value
+     * @param logMin output logarithm of minimal value
+     * @param logMax output logarithm of maximal value
+     */
+    void GetLogBounds(double minValue, double maxValue, double &logMin, double &logMax);
+
     bool m_longExponent;
 
     double m_logBase;
+    double m_logBaseLn; // natural logarithm of m_logBase
+
+    // cached logarithms of bounds
+    double m_cachedMin;
+    double m_cachedMax;
+    double m_cachedLogMin;
+    double m_cachedLogMax;
+
+    /**
+     * Returns minimal positive value of dataset at index in m_datasets.
+     * @param index dataset index
+     * @return minimal positive value, or 0 if there is no positive values
+     */
+    double GetPositiveMin(size_t index);
+
+    // minimal positive value of dataset, which bounds include not positive
+    // values, extended with appended values and rescanned on other changes
+    struct PositiveMin
+    {
+        Dataset *dataset;
+        unsigned long version;
+        wxVector<size_t> counts; // scanned value count of each serie
+        double value;
+    };
+    wxVector<PositiveMin> m_positiveMins; // parallel to m_datasets
 };
 
 #endif // LOGARITHMICNUMBERAXIS_H_INCLUDED
@@ -31,6 +31,7 @@ public:
     void SetTickFormat(const wxString &tickFormat)
     {
         m_tickFormat = tickFormat;
+        InvalidateTicks();
         FireAxisChanged();
     }
 
@@ -46,6 +47,7 @@ public:
         if (m_intValues != intValues) {
             m_intValues = intValues;
             // TODO recalc tick steps
+            InvalidateTicks();
             FireAxisChanged();
         }
     }
@@ -100,6 +102,26 @@ public:
      */
     void SetFixedBounds(double minValue, double maxValue);
 
+    /**
+     * Sets axis to fit its bounds to data visible in window of other axis.
+     * Used with vertical axis, to fit it to y values of points, that are
+     * visible in window of horizontal axis. XY datasets answer it with
+     * their range index (see XYDataset::SetUseRangeIndex).
+     * Usually used together with ZeroOrigin(false).
+     * Note: this setting is ignored if the axis bounds are set manually by SetFixedBounds.
+     * @param windowAxis axis, which window is used, or NULL to fit axis to all data
+     */
+    void SetFitToWindow(Axis *windowAxis);
+
+    /**
+     * Returns axis, to which window this axis fits its bounds.
+     * @return window axis or NULL
+     */
+    Axis *GetFitToWindow()
+    {
+        return m_windowAxis;
+    }
+
     /**
      * Returns bounds, taken from data, eg. real min-max value.
      * @param minValue output minimal data value
@@ -155,6 +177,7 @@ private:
     bool m_zeroOrigin;
     bool m_extraMajorInterval;
     double m_multiplier;
+    Axis *m_windowAxis;
 };
 
 #endif /*NUMBERAXIS_H_*/
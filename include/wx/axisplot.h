@@ -17,9 +17,11 @@
 #include <wx/legend.h>
 #include <wx/marker.h>
 #include <wx/crosshair.h>
+#include <wx/chartraster.h>
 #include <wx/chartpanel.h>
 
 #include <wx/dynarray.h>
+#include <wx/vector.h>
 
 
 /**
@@ -203,6 +205,77 @@ public:
      */
     void SetCrosshair(Crosshair *crosshair);
 
+    /**
+     * Sets deferred update mode. In this mode dataset changes and axis window
+     * changes only mark plot as dirty, and linked axes are updated once,
+     * right before plot is drawn. So any count of changes between two frames
+     * costs one axes update and one redraw.
+     * @param deferredUpdate true to defer updates
+     */
+    void SetDeferredUpdate(bool deferredUpdate);
+
+    bool GetDeferredUpdate()
+    {
+        return m_deferredUpdate;
+    }
+
+    /**
+     * Turns dataset layers on/off. In this mode every dataset is drawn to
+     * its own transparent bitmap, which is redrawn only when dataset is
+     * changed or its axes are moved, and other datasets are just blitted.
+     * Useful when large static dataset is combined with small live one.
+     * Has effect only when plot draws datasets with DrawDataset. Without
+     * wxUSE_GRAPHICS_CONTEXT in wxWidgets build option always stays off.
+     * @param datasetLayers true to turn on dataset layers
+     */
+    void SetDatasetLayers(bool datasetLayers);
+
+    bool GetDatasetLayers()
+    {
+        return m_datasetLayers;
+    }
+
+    /**
+     * Turns strip chart mode on/off. This mode is intended for streaming
+     * plots, where horizontal axis window advances by few pixels per frame.
+     * Data area of previous frame is scrolled by pixel delta of horizontal
+     * axes, and only exposed strip and newest data are drawn.
+     * Full redraw is done, when vertical axes bounds, horizontal axes scale,
+     * plot size or style are changed, or when datasets are changed other
+     * way than by appending points with growing x values and removing
+     * oldest points from serie start (DATASET_CHANGE_APPEND and
+     * DATASET_CHANGE_REMOVE of first points, see XYRingBufferDataset).
+     * Dataset layers are not used in this mode.
+     * @param stripChart true to turn on strip chart mode
+     */
+    void SetStripChart(bool stripChart);
+
+    bool GetStripChart()
+    {
+        return m_stripChart;
+    }
+
+    /**
+     * Turns software rasterizer on/off. When antialiasing is off and plot
+     * is drawn to memory DC (as chart panel does), datasets, that plot can
+     * rasterize (see CanRasterizeDataset), are drawn by ChartRaster
+     * directly to bitmap pixels instead of device context calls per line
+     * segment and symbol. Useful for very large scatter and line plots.
+     * @param softwareRaster true to turn on software rasterizer
+     */
+    void SetSoftwareRaster(bool softwareRaster);
+
+    bool GetSoftwareRaster()
+    {
+        return m_softwareRaster;
+    }
+
+    /**
+     * Applies pending deferred updates.
+     * Called before plot is drawn, can be called to get up to date axes.
+     */
+    void UpdatePending();
+
     /**
      * Translate coordinate from graphics to data space.
      * @param nData number of dataset
@@ -216,6 +289,13 @@ public:
      */
     bool ToDataCoords(size_t nData, wxDC &dc, wxRect rc, wxCoord gx, wxCoord gy, double *x, double *y);
 
+    /**
+     * Checks whether axes, grid, markers or legend changed since last check.
+     * Pending deferred updates are applied first.
+     * @return true if static layer must be redrawn
+     */
+    virtual bool CheckBackgroundChanged();
+
     //
     // DrawObserver
     //
@@ -226,6 +306,8 @@ public:
     //
     virtual void DatasetChanged(Dataset *dataset);
 
+    virtual void DatasetChanged(Dataset *dataset, const DatasetChange &change);
+
     //
     // AxisObserver
     //
@@ -259,10 +341,46 @@ protected:
 
     /**
      * Called to draw all datasets.
+     * Default implementation draws datasets one by one with DrawDataset.
      * @param dc device context
      * @param rc rectangle where to draw
      */
-    virtual void DrawDatasets(wxDC &dc, wxRect rc) = 0;
+    virtual void DrawDatasets(wxDC &dc, wxRect rc);
+
+    /**
+     * Called to draw single dataset.
+     * Must be overriden by derivative classes, that use default
+     * DrawDatasets implementation or dataset layers.
+     * @param dc device context
+     * @param rc rectangle where to draw
+     * @param dataset dataset to draw
+     */
+    virtual void DrawDataset(wxDC &dc, wxRect rc, Dataset *dataset);
+
+    /**
+     * Checks whether dataset can be drawn with software rasterizer.
+     * @param dataset dataset
+     * @return true if RasterizeDataset can draw dataset
+     */
+    virtual bool CanRasterizeDataset(Dataset *dataset);
+
+    /**
+     * Called to draw single dataset with software rasterizer.
+     * @param raster rasterizer, clipped to data area
+     * @param rc rectangle where to draw
+     * @param dataset dataset to draw
+     */
+    virtual void RasterizeDataset(ChartRaster &raster, wxRect rc, Dataset *dataset);
+
+    /**
+     * Called when dataset is linked with axis. Plot can set up
+     * drawing options here, that depend on dataset axes,
+     * instead of changing them while drawing.
+     * Default implementation does nothing.
+     * @param dataset dataset
+     * @param axis linked axis
+     */
+    virtual void DataAxisLinked(Dataset *dataset, Axis *axis);
 
     wxCoord GetAxesExtent(wxDC &dc, AxisArray *axes);
 
@@ -279,12 +397,141 @@ private:
 
     virtual void ChartPanelChanged(wxChartPanel *oldPanel, wxChartPanel *newPanel);
 
+    virtual void InvalidateBackground();
+
     bool UpdateAxis(Dataset *dataset = NULL);
 
+    /**
+     * Updates axes, that fit their bounds to window of axis.
+     * @param axis axis, which window was changed
+     */
+    void UpdateWindowAxes(Axis *axis);
+
+    /**
+     * Marks plot as having pending updates, and requests one redraw.
+     */
+    void SetUpdatePending();
+
     //
     // Draw functions
     //
 
+    /**
+     * Plot layout: data and legend areas and axes extents. Layout is cached
+     * until plot size, axes bounds, fonts or legend contents change.
+     */
+    struct PlotLayout
+    {
+        wxRect rc;
+        wxRect rcData;
+        wxRect rcLegend;
+        TextMeasureKey measureKey;
+        wxFont legendFont;
+        wxVector<double> axesBounds; // data and visible bounds of each axis
+        wxVector<wxCoord> axesExtents; // extents of left, right, top and bottom axes
+    };
+
+    /**
+     * Cached image of single dataset, see SetDatasetLayers.
+     */
+    struct DatasetLayer
+    {
+        Dataset *dataset;
+        bool valid;
+        wxBitmap bitmap;
+        wxVector<double> axesBounds; // data and visible bounds of dataset axes
+    };
+
+    /**
+     * Draws datasets through dataset layers, redrawing only invalid layers.
+     * @param dc device context
+     * @param rc data area rectangle
+     * @param antialias true to draw datasets with antialiasing
+     */
+    void DrawDatasetLayers(wxDC &dc, wxRect rc, bool antialias);
+
+    /**
+     * Draws dataset to layer bitmap.
+     * @param layer dataset layer
+     * @param rc data area rectangle
+     * @param antialias true to draw dataset with antialiasing
+     */
+    void DrawDatasetLayer(DatasetLayer &layer, wxRect rc, bool antialias);
+
+    /**
+     * Draws datasets, rasterizing ones that can be rasterized.
+     * @param mdc memory device context
+     * @param rc rectangle where to draw
+     * @param rcClip clipping rectangle
+     */
+    void DrawDatasetsRaster(wxMemoryDC &mdc, wxRect rc, wxRect rcClip);
+
+    /**
+     * Rasterizes run of datasets to bitmap selected into device context.
+     * @param mdc memory device context
+     * @param rc rectangle where to draw
+     * @param rcClip clipping rectangle
+     * @param first index of first dataset in run
+     * @return count of rasterized datasets, 0 if bitmap pixels cannot be accessed
+     */
+    size_t RasterizeDatasets(wxMemoryDC &mdc, wxRect rc, wxRect rcClip, size_t first);
+
+    /**
+     * Strip chart state of dataset, see SetStripChart.
+     */
+    struct StripDataset
+    {
+        Dataset *dataset;
+        double maxValue; // horizontal maximum of dataset on last frame
+        bool changed;
+    };
+
+    /**
+     * Last seen window of axis, used to tell scrolling from
+     * axis style change.
+     */
+    struct StripWindow
+    {
+        Axis *axis;
+        double winPos;
+        double winWidth;
+    };
+
+    /**
+     * Draws data area in strip chart mode.
+     * @param dc device context
+     * @param rc data area rectangle
+     * @param antialias true to draw datasets with antialiasing
+     */
+    void DrawStripChart(wxDC &dc, wxRect rc, bool antialias);
+
+    /**
+     * Draws part of data area to strip chart bitmap.
+     * @param rc data area rectangle
+     * @param rcStrip part of data area to draw
+     * @param antialias true to draw datasets with antialiasing
+     */
+    void DrawStrip(wxRect rc, wxRect rcStrip, bool antialias);
+
+    /**
+     * Marks dataset as changed for strip chart.
+     * @param dataset changed dataset
+     */
+    void StripDatasetChanged(Dataset *dataset);
+
+    /**
+     * Checks whether axis window is moved, or axis is changed other way.
+     * Invalidates strip chart in the latter case.
+     * @param axis changed axis
+     */
+    void StripAxisChanged(Axis *axis);
+
+    /**
+     * Invalidates layer of dataset.
+     * @param dataset dataset, or NULL to invalidate all layers
+     */
+    void InvalidateDatasetLayer(Dataset *dataset);
+
     /**
      * Calculate data area.
      * @param dc device context
@@ -294,6 +541,34 @@ private:
      */
     void CalcDataArea(wxDC &dc, wxRect rc, wxRect &rcData, wxRect &rcLegend);
 
+    /**
+     * Recalculates layout, if plot size or layout key changed.
+     * @param dc device context
+     * @param rc whole plot rectangle
+     */
+    void UpdateLayout(wxDC &dc, wxRect rc);
+
+    /**
+     * Calculates layout.
+     * @param dc device context
+     * @param rc whole plot rectangle
+     */
+    void CalcLayout(wxDC &dc, wxRect rc);
+
+    /**
+     * Calculates extents of axes and appends them to layout.
+     * @param dc device context
+     * @param axes axes array
+     * @return sum of axes extents
+     */
+    wxCoord CalcAxesExtents(wxDC &dc, AxisArray *axes);
+
+    void InvalidateLayout()
+    {
+        m_layoutValid = false;
+        InvalidateBackground();
+    }
+
     /**
      * Draws all axes.
      * @param dc device context
@@ -307,9 +582,10 @@ private:
      * @param dc device context
      * @param rc rectangle where to draw axes
      * @param axes axes array
+     * @param extents axes extents
      * @param vertical true to draw vertical axes, false - horizontal
      */
-    void DrawAxesArray(wxDC &dc, wxRect rc, AxisArray *axes, bool vertical);
+    void DrawAxesArray(wxDC &dc, wxRect rc, AxisArray *axes, const wxCoord *extents, bool vertical);
 
 
     /**
@@ -362,8 +638,39 @@ private:
     wxBitmap m_plotBackgroundBitmap; // Bitmap to hold the static (background) part of the plot.
     wxBitmap m_dataOverlayBitmap; // Bitmap on which the data (lines, bars etc.) is drawn.
     
-    bool m_redrawDataArea; // Flag to indicate if the background needs to be redrawn.
+    bool m_redrawDataArea; // Flag to indicate if the background needs to be redrawn, reset by CheckBackgroundChanged.
+
+    bool m_deferredUpdate;
+    bool m_updatePending;
+    bool m_applyingPending;
+    wxVector<Dataset *> m_pendingDatasets; // changed datasets, waiting for axes update
+    wxVector<Axis *> m_pendingWindowAxes; // axes with changed window
     wxRect m_drawRect; // Rectangle to see if the size changed.
+
+    PlotLayout m_layout;
+
+    bool m_datasetLayers;
+    wxVector<DatasetLayer> m_layers; // layers in datasets order
+    wxRect m_layersRect;
+    bool m_layersAntialias;
+
+    bool m_stripChart;
+    bool m_stripValid;
+    wxBitmap m_stripBitmap; // data area of last frame
+    wxBitmap m_stripBackBitmap; // bitmap to scroll data area into
+    wxRect m_stripRect;
+    bool m_stripAntialias;
+    AreaDraw *m_stripBackground; // background, data area was drawn with
+    wxVector<double> m_stripVertBounds; // bounds of vertical axes
+    wxVector<double> m_stripScales; // horizontal axes scales
+    wxVector<double> m_stripOffsets; // horizontal axes offsets on last full redraw
+    wxCoord m_stripShift; // pixels data area is scrolled by since last full redraw
+    wxVector<StripDataset> m_stripDatasets; // in datasets order
+    wxVector<StripWindow> m_stripWindows;
+
+    bool m_softwareRaster;
+    bool m_layoutValid;
+    bool m_updatingAxes; // axes bounds are being updated from datasets
 };
 
 #endif /*AXISPLOT_H_*/
@@ -30,7 +30,12 @@ protected:
 
     virtual bool AcceptDataset(Dataset *dataset);
 
-    virtual void DrawDatasets(wxDC &dc, wxRect rc);
+    virtual void DrawDataset(wxDC &dc, wxRect rc, Dataset *dataset);
+
+    virtual void DataAxisLinked(Dataset *dataset, Axis *axis);
+
+private:
+    bool GetBarsDirection(Axis *horizAxis, Axis *vertAxis, bool &verticalBars);
 };
 
 #endif /*BARPLOT_H_*/
@@ -110,6 +110,11 @@ protected:
 
 private:
     int m_barWidth;
+
+    // cached stacked maximum, valid while dataset version is unchanged
+    CategoryDataset *m_cachedDataset;
+    unsigned long m_cachedVersion;
+    double m_cachedMaxValue;
 };
 
 /**
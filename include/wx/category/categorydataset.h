@@ -65,6 +65,8 @@ public:
 
 protected:
     virtual bool AcceptRenderer(Renderer *r);
+
+    virtual bool IsRendererBounds();
 };
 
 #endif /*CATEGORYDATASET_H_*/
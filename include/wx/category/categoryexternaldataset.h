@@ -0,0 +1,84 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    categoryexternaldataset.h
+// Purpose: category dataset over caller owned records declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef CATEGORYEXTERNALDATASET_H_
+#define CATEGORYEXTERNALDATASET_H_
+
+#include <wx/category/categorydataset.h>
+#include <wx/externalbuffer.h>
+
+#include <wx/arrstr.h>
+#include <wx/vector.h>
+
+/**
+ * Category dataset, that reads values from caller owned record buffer
+ * without copying. Each record is category, and each serie is value field
+ * of records.
+ */
+class WXDLLIMPEXP_FREECHART CategoryExternalDataset : public CategoryDataset
+{
+    DECLARE_CLASS(CategoryExternalDataset)
+public:
+    /**
+     * Constructs new dataset.
+     * @param buffer record buffer, dataset takes ownership of it
+     * @param names category names; categories without name are named by number
+     */
+    CategoryExternalDataset(ExternalBuffer *buffer, const wxArrayString &names = wxArrayString());
+    virtual ~CategoryExternalDataset();
+
+    /**
+     * Adds serie.
+     * @param name serie name
+     * @param valueField value field
+     */
+    void AddSerie(const wxString &name, const ExternalField &valueField);
+
+    /**
+     * Makes more records of buffer valid.
+     * @param count count of new valid records
+     * @param names names of new categories
+     */
+    void RecordsAppended(size_t count, const wxArrayString &names = wxArrayString());
+
+    ExternalBuffer *GetBuffer()
+    {
+        return m_buffer;
+    }
+
+    //
+    // CategoryDataset
+    //
+    virtual double GetValue(size_t index, size_t serie);
+
+    virtual size_t GetSerieCount();
+
+    virtual wxString GetName(size_t index);
+
+    virtual size_t GetCount();
+
+    virtual wxString GetSerieName(size_t serie);
+
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys);
+
+    virtual const double *GetYColumn(size_t serie);
+
+private:
+    struct Serie
+    {
+        wxString name;
+        ExternalField valueField;
+    };
+
+    ExternalBuffer *m_buffer;
+    wxArrayString m_names;
+    wxVector<Serie> m_series;
+};
+
+#endif /* CATEGORYEXTERNALDATASET_H_ */
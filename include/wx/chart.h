@@ -82,6 +82,55 @@ public:
      */
     void Draw(ChartDC& dc, wxRect& rc, bool antialias = false);
 
+    /**
+     * Draws chart static layer: background, header, footer and
+     * plot background (axes, grid, legend, etc).
+     * @param dc device context
+     * @param rc rectangle where to draw chart, on return contains
+     * rectangle where plot is drawn
+     */
+    void DrawBackground(ChartDC& dc, wxRect& rc);
+
+    /**
+     * Draws chart data layer over static layer.
+     * @param dc device context
+     * @param rcPlot plot rectangle, returned by DrawBackground
+     */
+    void DrawData(ChartDC& dc, wxRect rcPlot);
+
+    /**
+     * Checks whether chart static layer changed since last check,
+     * and resets changed state. Static layer, drawn by DrawBackground,
+     * can be reused while this method returns false.
+     * @return true if static layer must be redrawn
+     */
+    bool CheckBackgroundChanged();
+
+    /**
+     * Renders chart to image without window, using graphics context.
+     * Can be called from worker thread, if wxWidgets port supports
+     * graphics contexts there (GDI+, Cairo and Core Graphics do), but
+     * chart must not be drawn by other threads (including chart panel)
+     * at same time, and its datasets must not be changed while rendering.
+     * Worker thread must call DrawResources::ReleaseThreadCache before exit.
+     * @param image output image, recreated with given size
+     * @param size image size
+     * @param antialias true to draw with antialiasing
+     * @return true if chart was rendered, false if graphics
+     * context cannot be created
+     */
+    bool RenderToImage(wxImage &image, const wxSize &size, bool antialias = false);
+
+    /**
+     * Renders chart to raw buffer of RGBA pixels, same way as RenderToImage.
+     * @param buffer output buffer, at least stride * size.y bytes
+     * @param size image size
+     * @param stride size of buffer row in bytes, at least size.x * 4
+     * @param antialias true to draw with antialiasing
+     * @return true if chart was rendered
+     */
+    bool RenderToRGBA(unsigned char *buffer, const wxSize &size, size_t stride, bool antialias = false);
+
     /**
      * Sets chart background.
      * @param background chart background
@@ -89,6 +138,7 @@ public:
     void SetBackground(AreaDraw *background)
     {
         wxREPLACE(m_background, background);
+        m_backgroundChanged = true;
         FireChartChanged();
     }
     
@@ -117,18 +167,21 @@ public:
     void SetHeader(Header* header)
     {
         wxREPLACE(m_header, header);
+        m_backgroundChanged = true;
         FireChartChanged();
     }
 
     void SetFooter(Footer* footer)
     {
         wxREPLACE(m_footer, footer);
+        m_backgroundChanged = true;
         FireChartChanged();
     }
 
     void SetMargin(wxCoord margin)
     {
         m_margin = margin;
+        m_backgroundChanged = true;
         FireChartChanged();
     }
 
@@ -171,6 +224,8 @@ private:
     int m_headerGap;
     wxCoord m_margin;
 
+    bool m_backgroundChanged; // static layer changed since last CheckBackgroundChanged
+
     Axis *m_horizScrolledAxis;
     Axis *m_vertScrolledAxis;
 
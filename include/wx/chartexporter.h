@@ -0,0 +1,231 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    chartexporter.h
+// Purpose: parallel batch chart export declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef CHARTEXPORTER_H_
+#define CHARTEXPORTER_H_
+
+#include <wx/wxfreechartdefs.h>
+#include <wx/chart.h>
+
+#include <wx/stream.h>
+#include <wx/thread.h>
+#include <wx/vector.h>
+
+class WXDLLIMPEXP_FREECHART ChartExporter;
+
+/**
+ * Export job states.
+ */
+enum CHART_EXPORT_STATE
+{
+    CHART_EXPORT_PENDING, // job is waiting or running
+    CHART_EXPORT_DONE, // image is rendered and saved
+    CHART_EXPORT_FAILED, // rendering or saving failed
+    CHART_EXPORT_CANCELLED // job was cancelled before it started
+};
+
+/**
+ * Interface to receive export progress.
+ */
+class WXDLLIMPEXP_FREECHART ChartExportObserver
+{
+public:
+    ChartExportObserver();
+    virtual ~ChartExportObserver();
+
+    /**
+     * Called when job is finished. Called from worker thread,
+     * so GUI must be updated with wxEvtHandler::CallAfter or similar.
+     * @param exporter exporter
+     * @param index job index, returned by AddJob
+     * @param state job state: CHART_EXPORT_DONE or CHART_EXPORT_FAILED
+     */
+    virtual void JobFinished(ChartExporter *exporter, size_t index, CHART_EXPORT_STATE state) = 0;
+};
+
+/**
+ * Renders charts to PNG files or streams on pool of worker threads.
+ * Charts are rendered by Chart::RenderToImage, and images are encoded
+ * on worker threads too, so GUI thread is only used to add jobs and
+ * start export.
+ *
+ * Drawing is not free of side effects: plots cache their layout, datasets
+ * cache their bounds and renderers keep scratch buffers. So jobs, that share
+ * chart, plot or any dataset (of axis plots, pie plots and subplots of
+ * multiplots), are never rendered at same time, while other jobs run in
+ * parallel. Charts and datasets must not be changed until export is
+ * finished, exporter only reads them.
+ *
+ * Usage:
+ * @code
+ * ChartExporter exporter;
+ * exporter.AddJob(chart1, wxSize(800, 600), wxT("chart1.png"));
+ * exporter.AddJob(chart2, wxSize(800, 600), wxT("chart2.png"));
+ * exporter.Start();
+ * ...
+ * exporter.Wait();
+ * @endcode
+ */
+class WXDLLIMPEXP_FREECHART ChartExporter
+{
+public:
+    /**
+     * Constructs new exporter.
+     * @param antialias true to render charts with antialiasing
+     */
+    ChartExporter(bool antialias = false);
+
+    /**
+     * Destroys exporter. Pending jobs are cancelled,
+     * and running jobs are waited for.
+     */
+    virtual ~ChartExporter();
+
+    /**
+     * Adds job, that saves chart to PNG file.
+     * Jobs can be added only before Start.
+     * @param chart chart to render, caller keeps ownership
+     * @param size image size
+     * @param path output file path
+     * @return job index
+     */
+    size_t AddJob(Chart *chart, const wxSize &size, const wxString &path);
+
+    /**
+     * Adds job, that writes chart as PNG to stream.
+     * Jobs can be added only before Start.
+     * @param chart chart to render, caller keeps ownership
+     * @param size image size
+     * @param stream output stream, caller keeps ownership,
+     * must not be used by other jobs
+     * @return job index
+     */
+    size_t AddJob(Chart *chart, const wxSize &size, wxOutputStream *stream);
+
+    /**
+     * Sets observer to receive export progress.
+     * Must be called before Start.
+     * @param observer observer, caller keeps ownership
+     */
+    void SetObserver(ChartExportObserver *observer);
+
+    /**
+     * Starts export on worker threads. Returns immediately.
+     * @param threadCount worker thread count, 0 - one per CPU
+     * @return true if at least one worker thread was started
+     */
+    bool Start(size_t threadCount = 0);
+
+    /**
+     * Cancels export. Jobs, that are not started yet, are cancelled,
+     * running jobs are finished. Can be called from any thread.
+     */
+    void Cancel();
+
+    /**
+     * Waits until all worker threads are finished.
+     */
+    void Wait();
+
+    /**
+     * Checks whether export was cancelled.
+     * @return true if export was cancelled
+     */
+    bool IsCancelled();
+
+    /**
+     * Checks whether all jobs are finished or cancelled.
+     * @return true if export is finished
+     */
+    bool IsFinished();
+
+    size_t GetJobCount();
+
+    /**
+     * Returns count of finished jobs, including failed ones.
+     * @return finished job count
+     */
+    size_t GetFinishedCount();
+
+    /**
+     * Returns count of failed jobs.
+     * @return failed job count
+     */
+    size_t GetFailedCount();
+
+    /**
+     * Returns job state.
+     * @param index job index
+     * @return job state
+     */
+    CHART_EXPORT_STATE GetJobState(size_t index);
+
+private:
+    class Worker : public wxThread
+    {
+    public:
+        Worker(ChartExporter *exporter);
+
+    protected:
+        virtual ExitCode Entry();
+
+    private:
+        ChartExporter *m_exporter;
+    };
+
+    struct Job
+    {
+        Chart *chart;
+        wxSize size;
+        wxString path;
+        wxOutputStream *stream;
+
+        wxVector<void *> resources; // objects changed by drawing
+        CHART_EXPORT_STATE state;
+        bool started;
+    };
+
+    size_t AddJob(Chart *chart, const wxSize &size, const wxString &path, wxOutputStream *stream);
+
+    void AddPlotResources(Job &job, Plot *plot);
+
+    void RunJobs();
+
+    bool TakeJob(size_t &index);
+
+    bool IsBusy(const Job &job);
+
+    void ReleaseResources(const Job &job);
+
+    bool SaveImage(const Job &job, const wxImage &image);
+
+    bool m_antialias;
+    ChartExportObserver *m_observer;
+
+    wxMutex m_mutex;
+    wxCondition m_condition;
+
+    // guarded by m_mutex
+    wxVector<Job> m_jobs;
+    wxVector<void *> m_busy;
+    size_t m_firstPending;
+    size_t m_pendingCount;
+    size_t m_finishedCount;
+    size_t m_failedCount;
+    bool m_cancelled;
+
+    bool m_started;
+    wxVector<Worker *> m_workers;
+
+    // non-copyable
+    ChartExporter(const ChartExporter &);
+    ChartExporter &operator=(const ChartExporter &);
+};
+
+#endif /* CHARTEXPORTER_H_ */
@@ -124,6 +124,10 @@ private:
 
     wxBitmap m_backBitmap;
 
+    wxBitmap m_staticBitmap; // cached static layer of chart
+    wxRect m_plotRect; // plot rectangle of static layer
+    bool m_staticValid;
+
     bool m_antialias;
 
     bool m_rerender;
@@ -0,0 +1,169 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    chartraster.h
+// Purpose: software rasterizer for aliased chart primitives declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef CHARTRASTER_H_
+#define CHARTRASTER_H_
+
+#include <wx/wxfreechartdefs.h>
+
+#include <wx/image.h>
+#include <wx/rawbmp.h>
+
+/**
+ * Draws aliased lines (Bresenham algorithm), filled rectangles and circles
+ * directly to pixel buffer, without device context calls per primitive.
+ * Used by AxisPlot to draw large datasets, when antialiasing is off
+ * (see AxisPlot::SetSoftwareRaster). Output matches wxDC drawing with
+ * solid pen closely, but not exactly at every pixel.
+ */
+class WXDLLIMPEXP_FREECHART ChartRaster
+{
+public:
+    /**
+     * Constructs rasterizer over raw pixel buffer.
+     * @param origin pointer to top left pixel
+     * @param width buffer width in pixels
+     * @param height buffer height in pixels
+     * @param stride distance between rows in bytes, can be negative
+     * @param pixelSize pixel size in bytes
+     * @param redOffset red channel offset in pixel
+     * @param greenOffset green channel offset in pixel
+     * @param blueOffset blue channel offset in pixel
+     * @param alphaOffset alpha channel offset in pixel, -1 if there is no alpha
+     */
+    ChartRaster(unsigned char *origin, int width, int height, int stride, int pixelSize,
+            int redOffset, int greenOffset, int blueOffset, int alphaOffset = -1);
+
+    /**
+     * Constructs rasterizer over bitmap pixel data.
+     * Bitmap must not be selected into device context while drawing.
+     * @param data bitmap pixel data
+     */
+    ChartRaster(wxNativePixelData &data);
+
+    /**
+     * Constructs rasterizer over image data.
+     * @param image image
+     */
+    ChartRaster(wxImage &image);
+
+    virtual ~ChartRaster();
+
+    /**
+     * Sets offset, that is added to all coordinates,
+     * same as device context logical origin.
+     * @param x horizontal offset
+     * @param y vertical offset
+     */
+    void SetOffset(wxCoord x, wxCoord y);
+
+    /**
+     * Sets clipping rectangle, in coordinates before offset.
+     * It is always limited to buffer size.
+     * @param rc clipping rectangle
+     */
+    void SetClippingRect(const wxRect &rc);
+
+    /**
+     * Returns clipping rectangle, in coordinates before offset.
+     * @return clipping rectangle
+     */
+    wxRect GetClippingRect() const;
+
+    /**
+     * Sets colour of subsequent drawing.
+     * @param colour colour
+     */
+    void SetColour(const wxColour &colour);
+
+    /**
+     * Sets width of subsequent lines. Wide lines are drawn
+     * with square pen tip.
+     * @param width line width in pixels
+     */
+    void SetLineWidth(int width);
+
+    /**
+     * Draws line, including both end points.
+     * @param x0 x coordinate of first point
+     * @param y0 y coordinate of first point
+     * @param x1 x coordinate of second point
+     * @param y1 y coordinate of second point
+     */
+    void DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1);
+
+    /**
+     * Draws polyline.
+     * @param count point count
+     * @param points points
+     */
+    void DrawLines(size_t count, const wxPoint *points);
+
+    /**
+     * Fills rectangle.
+     * @param x x coordinate of left side
+     * @param y y coordinate of top side
+     * @param width rectangle width
+     * @param height rectangle height
+     */
+    void FillRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height);
+
+    /**
+     * Fills circle, including its border, like wxDC::DrawCircle
+     * with pen and brush of same colour.
+     * @param x x coordinate of center
+     * @param y y coordinate of center
+     * @param radius circle radius
+     */
+    void FillCircle(wxCoord x, wxCoord y, wxCoord radius);
+
+private:
+    void Init(unsigned char *origin, int width, int height, int stride, int pixelSize,
+            int redOffset, int greenOffset, int blueOffset, int alphaOffset);
+
+    void PutPixel(int x, int y)
+    {
+        unsigned char *p = m_origin + y * m_stride + x * m_pixelSize;
+
+        for (int n = 0; n < m_pixelSize; n++) {
+            p[n] = m_pixel[n];
+        }
+    }
+
+    void FillSpan(int x0, int x1, int y);
+
+    void FillBox(int left, int top, int right, int bottom);
+
+    bool ClipLine(double &x0, double &y0, double &x1, double &y1, int margin);
+
+    unsigned char *m_origin;
+    int m_width;
+    int m_height;
+    int m_stride;
+    int m_pixelSize;
+
+    int m_redOffset;
+    int m_greenOffset;
+    int m_blueOffset;
+    int m_alphaOffset;
+
+    unsigned char m_pixel[4]; // current colour in buffer pixel format
+    int m_lineWidth;
+
+    wxCoord m_offsetX;
+    wxCoord m_offsetY;
+
+    // clipping rectangle in buffer coordinates, inclusive
+    int m_clipLeft;
+    int m_clipTop;
+    int m_clipRight;
+    int m_clipBottom;
+};
+
+#endif /* CHARTRASTER_H_ */
@@ -31,6 +31,219 @@ class DateTimeDataset;
 #define FOREACH_DATAITEM(index, serie, dataset) \
     for (size_t index = 0; index < dataset->GetCount(serie); index++)
 
+/**
+ * Dataset value dimensions, for which minimal/maximal values are cached.
+ */
+enum BOUNDS_DIMENSION {
+    BOUNDS_X = 0,
+    BOUNDS_Y,
+    BOUNDS_Z,
+    BOUNDS_DIMENSION_COUNT
+};
+
+/**
+ * Cached minimal/maximal values of one dataset dimension.
+ */
+class WXDLLIMPEXP_FREECHART DatasetBounds
+{
+public:
+    DatasetBounds()
+    {
+        Invalidate();
+    }
+
+    /**
+     * Marks bounds as invalid, so they will be recalculated on next request.
+     */
+    void Invalidate()
+    {
+        m_valid = false;
+        m_empty = true;
+        m_minValue = 0;
+        m_maxValue = 0;
+    }
+
+    /**
+     * Sets bounds, calculated by scanning data.
+     * @param empty true if dimension has no values
+     * @param minValue minimal value
+     * @param maxValue maximal value
+     */
+    void Set(bool empty, double minValue, double maxValue)
+    {
+        m_valid = true;
+        m_empty = empty;
+        m_minValue = minValue;
+        m_maxValue = maxValue;
+    }
+
+    /**
+     * Widens bounds to include value. Does nothing if bounds are invalid.
+     * @param value new value
+     */
+    void Extend(double value)
+    {
+        if (!m_valid) {
+            return ;
+        }
+
+        if (m_empty) {
+            m_minValue = m_maxValue = value;
+            m_empty = false;
+        }
+        else {
+            m_minValue = wxMin(m_minValue, value);
+            m_maxValue = wxMax(m_maxValue, value);
+        }
+    }
+
+    /**
+     * Checks whether removal of value can shrink bounds.
+     * @param value removed value
+     * @return true if value is current minimum or maximum
+     */
+    bool IsExtreme(double value) const
+    {
+        return value <= m_minValue || value >= m_maxValue;
+    }
+
+    bool IsValid() const
+    {
+        return m_valid;
+    }
+
+    bool IsEmpty() const
+    {
+        return m_empty;
+    }
+
+    double GetMinValue() const
+    {
+        return m_minValue;
+    }
+
+    double GetMaxValue() const
+    {
+        return m_maxValue;
+    }
+
+private:
+    bool m_valid;
+    bool m_empty;
+    double m_minValue;
+    double m_maxValue;
+};
+
+/**
+ * Serie index of change, that affects several series.
+ */
+#define DATASET_ALL_SERIES ((size_t) -1)
+
+/**
+ * Dataset change kinds.
+ */
+enum DATASET_CHANGE_KIND {
+    DATASET_CHANGE_ALL = 0, // anything may be changed
+    DATASET_CHANGE_APPEND, // values added to serie end
+    DATASET_CHANGE_UPDATE, // values replaced in place
+    DATASET_CHANGE_INSERT, // values inserted, following values shifted
+    DATASET_CHANGE_REMOVE, // values removed, following values shifted
+    DATASET_CHANGE_CLEAR, // all values removed
+    DATASET_CHANGE_RENAME, // serie name changed, values are same
+    DATASET_CHANGE_RENDERER // renderer changed, values are same
+};
+
+/**
+ * Describes what is changed in dataset: change kind, serie and
+ * range of affected values. Observers can use it to update their state
+ * incrementally, for example extend cached values for appended range only.
+ */
+class WXDLLIMPEXP_FREECHART DatasetChange
+{
+public:
+    /**
+     * Constructs change, for which anything may be changed.
+     */
+    DatasetChange()
+    {
+        Set(DATASET_CHANGE_ALL, DATASET_ALL_SERIES, 0, 0);
+    }
+
+    /**
+     * Constructs change.
+     * @param kind change kind
+     * @param serie changed serie, or DATASET_ALL_SERIES
+     * @param first index of first affected value
+     * @param count count of affected values
+     */
+    DatasetChange(DATASET_CHANGE_KIND kind, size_t serie = DATASET_ALL_SERIES, size_t first = 0, size_t count = 0)
+    {
+        Set(kind, serie, first, count);
+    }
+
+    /**
+     * Combines this change with next change, so result covers both.
+     * Changes of same kind are combined to union of their ranges,
+     * changes of different kinds are combined to DATASET_CHANGE_ALL.
+     * @param change next change
+     */
+    void Merge(const DatasetChange &change);
+
+    DATASET_CHANGE_KIND GetKind() const
+    {
+        return m_kind;
+    }
+
+    size_t GetSerie() const
+    {
+        return m_serie;
+    }
+
+    size_t GetFirst() const
+    {
+        return m_first;
+    }
+
+    size_t GetCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Checks whether change affects specified serie.
+     * @param serie serie index
+     * @return true if serie is affected
+     */
+    bool AffectsSerie(size_t serie) const
+    {
+        return m_serie == DATASET_ALL_SERIES || m_serie == serie;
+    }
+
+    /**
+     * Checks whether dataset values can be changed, so
+     * axes bounds and values calculated from them must be updated.
+     * @return false for rename and renderer changes
+     */
+    bool IsValuesChanged() const
+    {
+        return m_kind != DATASET_CHANGE_RENAME && m_kind != DATASET_CHANGE_RENDERER;
+    }
+
+private:
+    void Set(DATASET_CHANGE_KIND kind, size_t serie, size_t first, size_t count)
+    {
+        m_kind = kind;
+        m_serie = serie;
+        m_first = first;
+        m_count = count;
+    }
+
+    DATASET_CHANGE_KIND m_kind;
+    size_t m_serie;
+    size_t m_first;
+    size_t m_count;
+};
+
 /**
  * Base class that receives notifications about dataset changes.
  */
@@ -41,6 +254,15 @@ public:
     virtual ~DatasetObserver();
 
     virtual void DatasetChanged(Dataset *dataset) = 0;
+
+    /**
+     * Called when dataset is changed, with description of change.
+     * Default implementation calls DatasetChanged(dataset), so observers,
+     * that do not handle changes incrementally, need not override it.
+     * @param dataset changed dataset
+     * @param change what is changed
+     */
+    virtual void DatasetChanged(Dataset *dataset, const DatasetChange &change);
 };
 
 /**
@@ -77,6 +299,51 @@ public:
      */
     void EndUpdate();
 
+    /**
+     * Checks whether dataset is inside BeginUpdate/EndUpdate.
+     * @return true if dataset is being updated
+     */
+    bool IsUpdating() const
+    {
+        return m_updateCount != 0;
+    }
+
+    /**
+     * Checks whether one more change will be reported right after
+     * change, that observers are notified of. It is so, when EndUpdate
+     * reports removal from serie start before merged append,
+     * so observers can update axes once, on last change.
+     * @return true if reported change is followed by another one
+     */
+    bool HasNextChange() const
+    {
+        return m_changed;
+    }
+
+    /**
+     * Returns dataset version. Version is incremented on every dataset change,
+     * so objects that cache values calculated from dataset can check whether
+     * their cache is still valid.
+     * @return dataset version
+     */
+    unsigned long GetVersion() const
+    {
+        return m_version;
+    }
+
+    /**
+     * Returns version of last change, that could modify or remove existing
+     * values, that is any change except appends, renames and renderer changes.
+     * Objects, that cache values calculated from dataset at some version,
+     * can update their cache with appended values only, if modify version
+     * is not greater than it.
+     * @return modify version
+     */
+    unsigned long GetModifyVersion() const
+    {
+        return m_modifyVersion;
+    }
+
     /**
      * Returns serie count in this dataset.
      * @return serie count
@@ -141,24 +408,143 @@ public:
     /**
      * Called to indicate, that dataset is changed.
      * For call by derivate classes.
+     * @param invalidateBounds true to drop cached bounds, false if derivate class
+     * has already updated them with ExtendBounds/ValueRemoved
      */
-    void DatasetChanged();
+    void DatasetChanged(bool invalidateBounds = true);
+
+    /**
+     * Called to indicate, that dataset is changed, with description of change.
+     * Changes made between BeginUpdate/EndUpdate are merged to one, except
+     * removals from serie start followed by appends (streaming datasets),
+     * that are merged to one removal and one append.
+     * For call by derivate classes.
+     * @param change what is changed
+     * @param invalidateBounds true to drop cached bounds, false if derivate class
+     * has already updated them with ExtendBounds/ValueRemoved
+     */
+    void DatasetChanged(const DatasetChange &change, bool invalidateBounds = true);
 
 protected:
+    /**
+     * Returns dimension bounds. Bounds are cached, and recalculated
+     * with CalcBounds only when cache is invalid.
+     * @param dim dimension
+     * @param minValue output minimal value
+     * @param maxValue output maximal value
+     * @return false if dimension has no values
+     */
+    bool GetBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue);
+
+    /**
+     * Calculates dimension bounds by scanning data.
+     * Called when cached bounds are invalid. Default implementation has no values.
+     * @param dim dimension
+     * @param minValue output minimal value
+     * @param maxValue output maximal value
+     * @return false if dimension has no values
+     */
+    virtual bool CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue);
+
+    /**
+     * Widens cached bounds to include new value.
+     * Called by derivate classes when value is added.
+     * @param dim dimension
+     * @param value added value
+     */
+    void ExtendBounds(BOUNDS_DIMENSION dim, double value);
+
+    /**
+     * Called by derivate classes when value is removed or overwritten.
+     * Cached bounds are dropped only if value was current minimum or maximum.
+     * @param dim dimension
+     * @param value removed value
+     */
+    void ValueRemoved(BOUNDS_DIMENSION dim, double value);
+
+    /**
+     * Drops cached bounds for dimension.
+     * @param dim dimension
+     */
+    void InvalidateBounds(BOUNDS_DIMENSION dim);
+
+    /**
+     * Drops cached bounds for all dimensions.
+     * Called from DatasetChanged, derivate classes can override it
+     * to drop their own cached data.
+     */
+    virtual void InvalidateBounds();
+
+    /**
+     * Called from DatasetChanged for each change, also between
+     * BeginUpdate/EndUpdate, before observers are notified. Derivate classes
+     * can override it to update their own cached data incrementally.
+     * Default implementation does nothing.
+     * @param change what is changed
+     */
+    virtual void UpdateCaches(const DatasetChange &change);
+
     /**
      * Checks whether renderer is acceptable by this dataset.
      * TODO: this method must be removed, because acceptable renderer type depends on plot type.
      */
     virtual bool AcceptRenderer(Renderer *r) = 0;
 
+    /**
+     * Checks whether minimal/maximal values are calculated by renderer,
+     * so renderer changes can change axes bounds. Such changes are
+     * reported as DATASET_CHANGE_ALL instead of DATASET_CHANGE_RENDERER.
+     * Default implementation returns false.
+     * @return true if bounds depend on renderer
+     */
+    virtual bool IsRendererBounds();
+
     Renderer *m_renderer;
 private:
-    bool m_updating;
+    void RendererChanged();
+
+    void MergeChange(const DatasetChange &change);
+
+    int m_updateCount;
     bool m_changed;
+    DatasetChange m_pendingChange; // changes merged between BeginUpdate/EndUpdate
+    bool m_removed;
+    DatasetChange m_pendingRemove; // removals from serie start, fired before m_pendingChange
+
+    unsigned long m_version;
+    unsigned long m_modifyVersion;
+    DatasetBounds m_bounds[BOUNDS_DIMENSION_COUNT];
 
     MarkerArray m_markers;
 
-    FIRE_WITH_THIS(DatasetChanged);
+    FIRE_WITH_THIS_VALUE(DatasetChanged, const DatasetChange &, change);
+};
+
+/**
+ * Calls Dataset::BeginUpdate in constructor and Dataset::EndUpdate
+ * in destructor, so all changes made in scope produce one DatasetChanged event
+ * (or two, see Dataset::DatasetChanged). Scopes can be nested.
+ */
+class WXDLLIMPEXP_FREECHART DatasetUpdateLocker
+{
+public:
+    DatasetUpdateLocker(Dataset *dataset)
+    : m_dataset(dataset)
+    {
+        m_dataset->BeginUpdate();
+    }
+
+    ~DatasetUpdateLocker()
+    {
+        m_dataset->EndUpdate();
+    }
+
+private:
+    Dataset *m_dataset;
+
+    // non-copyable
+    DatasetUpdateLocker(const DatasetUpdateLocker &);
+    DatasetUpdateLocker &operator=(const DatasetUpdateLocker &);
 };
 
 /**
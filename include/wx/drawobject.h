@@ -11,9 +11,10 @@
 #define DRAWOBJECT_H_
 
 #include <wx/observable.h>
+#include <wx/drawresources.h>
 
-#define wxNoBrush *wxTheBrushList->FindOrCreateBrush(*wxBLACK, wxBRUSHSTYLE_TRANSPARENT)
-#define wxNoPen *wxThePenList->FindOrCreatePen(*wxBLACK, 1, wxPENSTYLE_TRANSPARENT)
+#define wxNoBrush *DrawResources::FindOrCreateBrush(*wxBLACK, wxBRUSHSTYLE_TRANSPARENT)
+#define wxNoPen *DrawResources::FindOrCreatePen(*wxBLACK, 1, wxPENSTYLE_TRANSPARENT)
 
 class WXDLLIMPEXP_FREECHART DrawObject;
 
@@ -0,0 +1,57 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    drawresources.h
+// Purpose: thread local pen and brush caches declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef DRAWRESOURCES_H_
+#define DRAWRESOURCES_H_
+
+#include <wx/wxfreechartdefs.h>
+
+/**
+ * Pen and brush caches, used by chart drawing code instead of
+ * wxThePenList and wxTheBrushList. Global wx lists are not thread safe,
+ * while charts can be rendered from worker threads (see Chart::RenderToImage),
+ * so every thread has its own caches. Returned objects are owned by cache
+ * of calling thread and are valid until it is released, so they must be
+ * copied, when stored in objects, that can be used by other threads.
+ * Caches of worker threads must be released with ReleaseThreadCache before
+ * thread exits, cache of main thread is released on wx library cleanup.
+ */
+class WXDLLIMPEXP_FREECHART DrawResources
+{
+public:
+    /**
+     * Finds pen with given attributes in cache of calling thread,
+     * or creates new one.
+     * @param colour pen colour
+     * @param width pen width
+     * @param style pen style
+     * @return pen
+     */
+    static wxPen *FindOrCreatePen(const wxColour &colour, int width = 1, wxPenStyle style = wxPENSTYLE_SOLID);
+
+    /**
+     * Finds brush with given attributes in cache of calling thread,
+     * or creates new one.
+     * @param colour brush colour
+     * @param style brush style
+     * @return brush
+     */
+    static wxBrush *FindOrCreateBrush(const wxColour &colour, wxBrushStyle style = wxBRUSHSTYLE_SOLID);
+
+    /**
+     * Deletes pens and brushes cached by calling thread. Must be called
+     * by worker threads, that draw charts, before they exit.
+     */
+    static void ReleaseThreadCache();
+
+private:
+    DrawResources();
+};
+
+#endif /* DRAWRESOURCES_H_ */
@@ -92,6 +92,42 @@ inline static void Margins(wxRect &rc, wxCoord left, wxCoord top, wxCoord right,
     CheckFixRect(rc);
 }
 
+/**
+ * Identifies device context resolution and scale. Text extents measured
+ * on one device context are valid for others with same key, so they can
+ * be cached until fonts or texts change.
+ */
+class TextMeasureKey
+{
+public:
+    TextMeasureKey()
+    {
+        m_scaleX = 0;
+        m_scaleY = 0;
+    }
+
+    TextMeasureKey(wxDC &dc)
+    {
+        m_ppi = dc.GetPPI();
+        dc.GetUserScale(&m_scaleX, &m_scaleY);
+    }
+
+    bool operator==(const TextMeasureKey &o) const
+    {
+        return m_ppi == o.m_ppi && m_scaleX == o.m_scaleX && m_scaleY == o.m_scaleY;
+    }
+
+    bool operator!=(const TextMeasureKey &o) const
+    {
+        return !(*this == o);
+    }
+
+private:
+    wxSize m_ppi;
+    double m_scaleX;
+    double m_scaleY;
+};
+
 /**
  * Sets rectangle from two points.
  * @param rc rectangle
@@ -0,0 +1,187 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    externalbuffer.h
+// Purpose: caller owned record buffer declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef EXTERNALBUFFER_H_
+#define EXTERNALBUFFER_H_
+
+#include <wx/wxfreechartdefs.h>
+
+#include <string.h>
+
+/**
+ * Field value types.
+ */
+enum FIELD_TYPE {
+    FIELD_DOUBLE = 0,
+    FIELD_FLOAT,
+    FIELD_INT16,
+    FIELD_INT32,
+    FIELD_INT64,
+    FIELD_INDEX, /* value is record index, field has no storage */
+    FIELD_NONE /* value is always 0, field has no storage */
+};
+
+/**
+ * Describes value field in record: byte offset from record start and type.
+ */
+struct WXDLLIMPEXP_FREECHART ExternalField
+{
+    ExternalField(size_t _offset = 0, FIELD_TYPE _type = FIELD_DOUBLE)
+    : offset(_offset), type(_type)
+    {
+    }
+
+    /**
+     * Returns field, which values are record indexes.
+     */
+    static ExternalField Index()
+    {
+        return ExternalField(0, FIELD_INDEX);
+    }
+
+    /**
+     * Returns field, that is absent in record.
+     */
+    static ExternalField None()
+    {
+        return ExternalField(0, FIELD_NONE);
+    }
+
+    size_t offset;
+    FIELD_TYPE type;
+};
+
+/**
+ * Function, that is called when buffer is no longer used by chart.
+ * @param base buffer base pointer
+ * @param userData user data passed to ExternalBuffer
+ */
+typedef void (*ExternalBufferRelease)(const void *base, void *userData);
+
+/**
+ * Record buffer, that is owned by caller. Records are located at
+ * base + index * stride, and fields are read directly from it, so charting
+ * adds no copies. Buffer must stay valid until release function is called.
+ * Owner may append records in place and make them valid with SetCount.
+ */
+class WXDLLIMPEXP_FREECHART ExternalBuffer
+{
+public:
+    /**
+     * Constructs new external buffer.
+     * @param base pointer to first record
+     * @param stride record size in bytes
+     * @param count count of valid records
+     * @param release function to be called, when buffer is released, or NULL
+     * @param userData data passed to release function
+     */
+    ExternalBuffer(const void *base, size_t stride, size_t count,
+            ExternalBufferRelease release = NULL, void *userData = NULL);
+
+    virtual ~ExternalBuffer();
+
+    /**
+     * Returns field value of record.
+     * @param index record index
+     * @param field field
+     * @return field value
+     */
+    double GetValue(size_t index, const ExternalField &field) const
+    {
+        const char *p = m_base + index * m_stride + field.offset;
+
+        // fields are read with memcpy, because records may be packed
+        switch (field.type) {
+        case FIELD_DOUBLE: {
+            double v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        case FIELD_FLOAT: {
+            float v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        case FIELD_INT16: {
+            wxInt16 v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        case FIELD_INT32: {
+            wxInt32 v;
+            memcpy(&v, p, sizeof(v));
+            return v;
+        }
+        case FIELD_INT64: {
+            wxInt64 v;
+            memcpy(&v, p, sizeof(v));
+            return (double) v;
+        }
+        case FIELD_INDEX:
+            return index;
+        default:
+            return 0;
+        }
+    }
+
+    /**
+     * Reads field values of range of records.
+     * @param first index of first record
+     * @param count record count
+     * @param field field
+     * @param values output buffer
+     */
+    void GetValues(size_t first, size_t count, const ExternalField &field, double *values) const;
+
+    /**
+     * Returns pointer to field values, if they can be accessed directly
+     * as double array (records consist of single aligned double field).
+     * @param field field
+     * @return values or NULL
+     */
+    const double *GetColumn(const ExternalField &field) const;
+
+    /**
+     * Sets count of valid records.
+     * @param count record count
+     */
+    void SetCount(size_t count)
+    {
+        m_count = count;
+    }
+
+    size_t GetCount() const
+    {
+        return m_count;
+    }
+
+    size_t GetStride() const
+    {
+        return m_stride;
+    }
+
+    const void *GetBase() const
+    {
+        return m_base;
+    }
+
+private:
+    const char *m_base;
+    size_t m_stride;
+    size_t m_count;
+
+    ExternalBufferRelease m_release;
+    void *m_userData;
+
+    // non-copyable, release function must be called once
+    ExternalBuffer(const ExternalBuffer &);
+    ExternalBuffer &operator=(const ExternalBuffer &);
+};
+
+#endif /* EXTERNALBUFFER_H_ */
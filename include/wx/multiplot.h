@@ -44,6 +44,25 @@ public:
         FirePlotNeedRedraw();
     }
 
+    /**
+     * Returns subplot count.
+     * @return subplot count
+     */
+    size_t GetPlotCount()
+    {
+        return m_subPlots.Count();
+    }
+
+    /**
+     * Returns subplot at specified index.
+     * @param index index of subplot
+     * @return subplot
+     */
+    Plot *GetPlot(size_t index)
+    {
+        return m_subPlots[index];
+    }
+
     //
     // PlotObserver
     //
@@ -95,6 +95,13 @@ protected:
         (*it)->proc(this);                                            \
 }
 
+#define FIRE_WITH_THIS_VALUE(proc, type, value) void Fire##proc(type value)    \
+{                                                                    \
+    for (std::vector<Observer*>::iterator it = observers.begin();    \
+         it < observers.end(); it++)                                \
+        (*it)->proc(this, value);                                    \
+}
+
 #define FIRE_VOID(proc) void Fire##proc()                        \
 {                                                                    \
     for (std::vector<Observer*>::iterator it = observers.begin();    \
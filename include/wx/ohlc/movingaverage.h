@@ -13,6 +13,8 @@
 #include <wx/xy/xydataset.h>
 #include <wx/ohlc/ohlcdataset.h>
 
+#include <wx/vector.h>
+
 /**
  * Simple moving average indicator.
  */
@@ -43,9 +45,18 @@ public:
     //
     virtual void DatasetChanged(Dataset *dataset);
 
+    virtual void DatasetChanged(Dataset *dataset, const DatasetChange &change);
+
 private:
+    /**
+     * Calculates averages, that are not calculated yet.
+     */
+    void CalcAverages();
+
     OHLCDataset *m_ohlcDataset;
     int m_period;
+
+    wxVector<double> m_averages; // calculated averages
 };
 
 #endif /* MOVINGAVERAGE_H_ */
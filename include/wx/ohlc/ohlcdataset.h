@@ -47,7 +47,7 @@ public:
     void SetSerieName(const wxString &serieName)
     {
         m_serieName = serieName;
-        DatasetChanged();
+        DatasetChanged(DatasetChange(DATASET_CHANGE_RENAME, 0), false);
     }
 
     /**
@@ -85,6 +85,8 @@ public:
 protected:
     virtual bool AcceptRenderer(Renderer *r);
 
+    virtual bool CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue);
+
     wxString m_serieName;
 };
 
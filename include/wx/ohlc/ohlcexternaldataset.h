@@ -0,0 +1,75 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    ohlcexternaldataset.h
+// Purpose: OHLC dataset over caller owned records declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef OHLCEXTERNALDATASET_H_
+#define OHLCEXTERNALDATASET_H_
+
+#include <wx/ohlc/ohlcdataset.h>
+#include <wx/externalbuffer.h>
+
+/**
+ * OHLC dataset, that reads items from caller owned record buffer
+ * without copying.
+ */
+class WXDLLIMPEXP_FREECHART OHLCExternalDataset : public OHLCDataset
+{
+    DECLARE_CLASS(OHLCExternalDataset)
+public:
+    /**
+     * Constructs new dataset.
+     * @param buffer record buffer, dataset takes ownership of it
+     * @param open open field
+     * @param high high field
+     * @param low low field
+     * @param close close field
+     * @param volume volume field, or ExternalField::None()
+     * @param date date field (time_t seconds)
+     */
+    OHLCExternalDataset(ExternalBuffer *buffer,
+            const ExternalField &open, const ExternalField &high,
+            const ExternalField &low, const ExternalField &close,
+            const ExternalField &volume, const ExternalField &date);
+    virtual ~OHLCExternalDataset();
+
+    /**
+     * Makes more records of buffer valid.
+     * @param count count of new valid records
+     */
+    void RecordsAppended(size_t count);
+
+    ExternalBuffer *GetBuffer()
+    {
+        return m_buffer;
+    }
+
+    /**
+     * Returns item. Returned item is valid until next call.
+     * @param index item index
+     * @return item
+     */
+    virtual OHLCItem *GetItem(size_t index);
+
+    virtual size_t GetCount();
+
+    virtual time_t GetDate(size_t index);
+
+private:
+    ExternalBuffer *m_buffer;
+
+    ExternalField m_open;
+    ExternalField m_high;
+    ExternalField m_low;
+    ExternalField m_close;
+    ExternalField m_volume;
+    ExternalField m_date;
+
+    OHLCItem m_item;
+};
+
+#endif /* OHLCEXTERNALDATASET_H_ */
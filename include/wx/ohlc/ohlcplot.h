@@ -31,7 +31,7 @@ protected:
 
     virtual bool AcceptDataset(Dataset *dataset);
 
-    virtual void DrawDatasets(wxDC &dc, wxRect rc);
+    virtual void DrawDataset(wxDC &dc, wxRect rc, Dataset *dataset);
 
     /**
      * Draw single OHLC dataset.
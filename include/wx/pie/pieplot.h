@@ -32,6 +32,11 @@ public:
 
     void SetDataset(CategoryDataset *dataset);
 
+    CategoryDataset *GetDataset()
+    {
+        return m_dataset;
+    }
+
     void SetUsedSerie(size_t serie)
     {
         m_serie = serie;
@@ -75,6 +75,16 @@ public:
      */
     wxChartPanel *GetChartPanel();
 
+    /**
+     * Checks whether plot static layer (everything drawn in PLOT_DRAW_BACKGROUND
+     * mode) changed since last check, and resets changed state.
+     * Used to reuse cached static layer, when only data changed.
+     * Default implementation always returns true, so static layer is
+     * redrawn every time.
+     * @return true if static layer must be redrawn
+     */
+    virtual bool CheckBackgroundChanged();
+
 
     /**
      * Sets plot background.
@@ -83,6 +93,7 @@ public:
     void SetBackground(AreaDraw *background)
     {
         wxREPLACE(m_background, background);
+        InvalidateBackground();
         FirePlotNeedRedraw();
     }
 
@@ -127,6 +138,12 @@ protected:
      */
     virtual void ChartPanelChanged(wxChartPanel *oldPanel, wxChartPanel *newPanel);
 
+    /**
+     * Called when plot static layer is changed.
+     * Default implementation does nothing.
+     */
+    virtual void InvalidateBackground();
+
     FIRE_WITH_THIS(PlotNeedRedraw);
 
     AreaDraw *m_background;
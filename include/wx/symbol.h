@@ -11,6 +11,7 @@
 #define SYMBOL_H_
 
 #include <wx/wxfreechartdefs.h>
+#include <wx/chartraster.h>
 
 /**
  * Symbols base class.
@@ -30,6 +31,20 @@ public:
      */
     virtual void Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color) = 0;
 
+    /**
+     * Checks whether symbol can be drawn by software rasterizer.
+     * @return true if symbol implements Rasterize
+     */
+    virtual bool CanRasterize();
+
+    /**
+     * Draws symbol with software rasterizer.
+     * @param raster rasterizer, its colour is set by caller
+     * @param x x coordinate
+     * @param y y coordinate
+     */
+    virtual void Rasterize(ChartRaster &raster, wxCoord x, wxCoord y);
+
     /**
      * Called to calculate size required for symbol.
      * @return size required for symbol
@@ -91,6 +106,10 @@ public:
     virtual ~CircleSymbol();
 
     virtual void Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color);
+
+    virtual bool CanRasterize();
+
+    virtual void Rasterize(ChartRaster &raster, wxCoord x, wxCoord y);
 };
 
 /**
@@ -103,6 +122,10 @@ public:
     virtual ~SquareSymbol();
 
     virtual void Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color);
+
+    virtual bool CanRasterize();
+
+    virtual void Rasterize(ChartRaster &raster, wxCoord x, wxCoord y);
 };
 
 /**
@@ -115,6 +138,10 @@ public:
     virtual ~CrossSymbol();
 
     virtual void Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color);
+
+    virtual bool CanRasterize();
+
+    virtual void Rasterize(ChartRaster &raster, wxCoord x, wxCoord y);
 };
 
 /**
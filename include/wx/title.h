@@ -14,6 +14,7 @@
 #include <wx/arrstr.h>
 #include <wx/hashmap.h>
 #include <wx/defs.h>
+#include <wx/drawutils.h>
 
 /**
  * Represents a TitleElement, ie a box containing text which is displayed in the title area.
@@ -107,6 +108,8 @@ public:
 
     /**
      * Calculates the extent of the TextElementContainer.
+     * Extent is cached until elements are added or device context
+     * resolution changes.
      * @param dc  A wxDC drawing context.
      * @param rc  The rectangle of the drawing area
      * @return The dimension of the TextElementContainer.
@@ -117,6 +120,9 @@ private:
     Elements m_elements;
     wxSize m_extent;
     size_t m_margin;
+
+    bool m_extentValid;
+    TextMeasureKey m_extentKey;
 };
 
 
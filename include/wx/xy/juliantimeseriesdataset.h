@@ -36,6 +36,8 @@ public:
 
     virtual double GetY(size_t index, size_t serie);
 
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys);
+
     void clear();
     void reserve(size_t length);
     void push_back(const TimePair& tvpair);
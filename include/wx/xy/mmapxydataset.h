@@ -0,0 +1,120 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    mmapxydataset.h
+// Purpose: memory mapped xy dataset declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef MMAPXYDATASET_H_
+#define MMAPXYDATASET_H_
+
+#include <wx/xy/xydataset.h>
+
+struct MmapXYSerieEntry;
+
+/**
+ * XY dataset, that maps binary file read-only into memory.
+ * Columns are accessed directly in mapped file, so nothing is copied
+ * at open, and operating system pages in only parts of file, that are
+ * actually read (usually visible window of sorted series).
+ *
+ * File layout (native little-endian byte order, all offsets from file start):
+ * <ul>
+ *     <li>header, 16 bytes: char magic[8] = "WXFCXYD\0", uint32 version = 1,
+ *     uint32 serie count</li>
+ *     <li>serie table, 96 bytes per serie: uint64 point count, uint64 x column offset,
+ *     uint64 y column offset, double minimal x, double maximal x, double minimal y,
+ *     double maximal y, uint32 flags (bit 0 - x values are ascending), uint32 reserved,
+ *     char name[32] (UTF-8, zero padded)</li>
+ *     <li>column blocks: arrays of point count doubles, aligned to 8 bytes</li>
+ * </ul>
+ * Bounds are stored in serie table, so they are known without reading columns.
+ * Use Write to create file from any XYDataset.
+ */
+class WXDLLIMPEXP_FREECHART MmapXYDataset : public XYDataset
+{
+    DECLARE_CLASS(MmapXYDataset)
+public:
+    MmapXYDataset();
+
+    /**
+     * Constructs dataset and maps file.
+     * @param filename file name
+     */
+    MmapXYDataset(const wxString &filename);
+
+    virtual ~MmapXYDataset();
+
+    /**
+     * Maps file. Previously mapped file is unmapped.
+     * @param filename file name
+     * @return true if file is mapped and has valid layout
+     */
+    bool Open(const wxString &filename);
+
+    /**
+     * Unmaps file.
+     */
+    void Close();
+
+    /**
+     * Checks whether file is mapped.
+     * @return true if file is mapped
+     */
+    bool IsOk() const
+    {
+        return m_data != NULL;
+    }
+
+    /**
+     * Writes dataset to file in layout, that can be mapped by MmapXYDataset.
+     * Dataset is read by blocks, so it need not to fit in memory.
+     * @param filename file name
+     * @param dataset dataset to write
+     * @return true on success
+     */
+    static bool Write(const wxString &filename, XYDataset *dataset);
+
+    virtual size_t GetSerieCount();
+
+    virtual wxString GetSerieName(size_t serie);
+
+    virtual size_t GetCount(size_t serie);
+
+    virtual double GetX(size_t index, size_t serie);
+
+    virtual double GetY(size_t index, size_t serie);
+
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys);
+
+    virtual const double *GetXColumn(size_t serie);
+
+    virtual const double *GetYColumn(size_t serie);
+
+    virtual bool IsXSorted(size_t serie);
+
+protected:
+    virtual bool CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue);
+
+private:
+    bool Map(const wxString &filename);
+
+    void Unmap();
+
+    bool CheckLayout();
+
+    const MmapXYSerieEntry *GetEntry(size_t serie) const;
+
+    const char *m_data;
+    size_t m_size;
+    size_t m_serieCount;
+
+#ifdef __WINDOWS__
+    void *m_file;
+    void *m_mapping;
+#endif
+};
+
+#endif /* MMAPXYDATASET_H_ */
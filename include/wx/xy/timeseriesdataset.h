@@ -33,6 +33,8 @@ public:
 
     virtual double GetY(size_t index, size_t serie);
 
+    virtual const double *GetYColumn(size_t serie);
+
     virtual DateTimeDataset *AsDateTimeDataset();
 
     //
@@ -41,6 +41,8 @@ public:
 
     virtual double GetY(size_t index, size_t serie);
 
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys);
+
     /**
      * Adds y values to dataset.
      * @param y y value
@@ -26,10 +26,21 @@ public:
     void SetFillToZero(bool val) { m_fillZero = val; }
     bool GetFillToZero() const { return m_fillZero; }
 
+    /**
+     * Sets whether to reduce area outline points in each pixel column to
+     * first, minimal, maximal and last ones before drawing.
+     * Area looks same, but drawing time depends on plot width,
+     * not on serie size. Disabled by default.
+     * @param decimation true to enable decimation
+     */
+    void SetDecimation(bool decimation);
+    bool GetDecimation() const { return m_decimation; }
+
 private:
     wxPen m_outlinePen;
     wxBrush m_areaBrush;
     bool m_fillZero;
+    bool m_decimation;
 };
 
 #endif /*XYAREARENDERER_H_*/
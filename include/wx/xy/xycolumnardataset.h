@@ -0,0 +1,254 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xycolumnardataset.h
+// Purpose: xy columnar serie and dataset declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef XYCOLUMNARDATASET_H_
+#define XYCOLUMNARDATASET_H_
+
+#include <wx/xy/xydataset.h>
+
+#include <wx/vector.h>
+
+class WXDLLIMPEXP_FREECHART XYColumnarDataset;
+
+/**
+ * XY serie, that stores x and y values in separate contiguous columns.
+ * Allows fast bulk append and gives renderers direct access to columns.
+ * Every modification notifies owning dataset, use Dataset::BeginUpdate/EndUpdate
+ * to batch several modifications into one notification.
+ */
+class WXDLLIMPEXP_FREECHART XYColumnarSerie : public wxObject
+{
+    DECLARE_CLASS(XYColumnarSerie)
+public:
+    friend class XYColumnarDataset;
+
+    XYColumnarSerie();
+
+    /**
+     * Constructs new serie from x and y columns.
+     * @param xs x values
+     * @param ys y values, must have same size as xs
+     */
+    XYColumnarSerie(const wxVector<double> &xs, const wxVector<double> &ys);
+
+    /**
+     * Constructs new serie from points.
+     * @param data serie points
+     */
+    XYColumnarSerie(const wxVector<wxRealPoint> &data);
+
+    virtual ~XYColumnarSerie();
+
+    /**
+     * Reserves memory for specified point count.
+     * @param count point count
+     */
+    void Reserve(size_t count);
+
+    /**
+     * Appends point to the end of serie.
+     * @param x x value
+     * @param y y value
+     */
+    void Append(double x, double y);
+
+    /**
+     * Appends point to the end of serie.
+     * @param pt point
+     */
+    void Append(const wxRealPoint &pt);
+
+    /**
+     * Appends range of points to the end of serie with one notification.
+     * @param xs x values
+     * @param ys y values
+     * @param count point count
+     */
+    void Append(const double *xs, const double *ys, size_t count);
+
+    /**
+     * Inserts point at specified index.
+     * @param index insert position
+     * @param x x value
+     * @param y y value
+     */
+    void Insert(size_t index, double x, double y);
+
+    /**
+     * Removes points.
+     * @param index index of first point to remove
+     * @param count point count to remove
+     */
+    void Remove(size_t index, size_t count = 1);
+
+    /**
+     * Removes first point and appends new one, keeping point count.
+     * Used to scroll data in strip charts.
+     * @param x x value of new point
+     * @param y y value of new point
+     */
+    void Shift(double x, double y);
+
+    /**
+     * Removes all points.
+     */
+    void Clear();
+
+    /**
+     * Updates point at specified index.
+     * @param index point index
+     * @param x new x value
+     * @param y new y value
+     */
+    void UpdatePoint(size_t index, double x, double y);
+
+    /**
+     * Replaces all serie points.
+     * @param xs x values
+     * @param ys y values, must have same size as xs
+     */
+    void SetValues(const wxVector<double> &xs, const wxVector<double> &ys);
+
+    /**
+     * Returns x value at specified index.
+     * @param index point index
+     * @return x value
+     */
+    double GetX(size_t index) const
+    {
+        return m_xs[index];
+    }
+
+    /**
+     * Returns y value at specified index.
+     * @param index point index
+     * @return y value
+     */
+    double GetY(size_t index) const
+    {
+        return m_ys[index];
+    }
+
+    /**
+     * Returns pointer to x values column.
+     * Pointer is valid until serie is changed.
+     * @return x values or NULL if serie is empty
+     */
+    const double *GetXData() const
+    {
+        return m_xs.empty() ? NULL : &m_xs[0];
+    }
+
+    /**
+     * Returns pointer to y values column.
+     * Pointer is valid until serie is changed.
+     * @return y values or NULL if serie is empty
+     */
+    const double *GetYData() const
+    {
+        return m_ys.empty() ? NULL : &m_ys[0];
+    }
+
+    /**
+     * Returns point count. Invisible serie has no points.
+     * @return point count
+     */
+    size_t GetCount() const
+    {
+        return m_visible ? m_xs.size() : 0;
+    }
+
+    /**
+     * Sets whether serie is visible.
+     * @param visible true to show serie
+     */
+    void SetVisible(bool visible = true);
+
+    bool IsVisible() const
+    {
+        return m_visible;
+    }
+
+    const wxString &GetName() const
+    {
+        return m_name;
+    }
+
+    void SetName(const wxString &name);
+
+private:
+    void PointsAppended(size_t first);
+
+    void PointsChanged(size_t first, DATASET_CHANGE_KIND kind = DATASET_CHANGE_ALL);
+
+    XYColumnarDataset *m_dataset;
+
+    wxVector<double> m_xs;
+    wxVector<double> m_ys;
+
+    wxString m_name;
+    bool m_visible;
+
+    // x values order: -1 unknown, 0 unsorted, 1 ascending
+    int m_xSorted;
+};
+
+/**
+ * XY dataset with columnar series.
+ * Series are owned by dataset.
+ */
+class WXDLLIMPEXP_FREECHART XYColumnarDataset : public XYDataset
+{
+    DECLARE_CLASS(XYColumnarDataset)
+public:
+    friend class XYColumnarSerie;
+
+    XYColumnarDataset();
+    virtual ~XYColumnarDataset();
+
+    /**
+     * Adds serie to dataset. Dataset takes ownership of serie.
+     * @param serie serie to be added
+     */
+    void AddSerie(XYColumnarSerie *serie);
+
+    /**
+     * Returns serie.
+     * @param serie serie index
+     * @return serie
+     */
+    XYColumnarSerie *GetSerie(size_t serie);
+
+    void SetSerieName(size_t serie, const wxString &name);
+
+    virtual size_t GetSerieCount();
+
+    virtual wxString GetSerieName(size_t serie);
+
+    virtual size_t GetCount(size_t serie);
+
+    virtual double GetX(size_t index, size_t serie);
+
+    virtual double GetY(size_t index, size_t serie);
+
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys);
+
+    virtual const double *GetXColumn(size_t serie);
+
+    virtual const double *GetYColumn(size_t serie);
+
+    virtual bool IsXSorted(size_t serie);
+
+private:
+    size_t GetSerieIndex(XYColumnarSerie *serie);
+
+    wxVector<XYColumnarSerie *> m_series;
+};
+
+#endif /* XYCOLUMNARDATASET_H_ */
@@ -13,7 +13,10 @@
 #include <wx/dataset.h>
 #include <wx/axis/axis.h>
 
+#include <wx/vector.h>
+
 class XYRenderer;
+class XYRangeIndex;
 
 /**
  * Base class for XY datasets.
@@ -44,6 +47,101 @@ public:
      */
     virtual double GetY(size_t index, size_t serie) = 0;
 
+    /**
+     * Copies x and y values of serie points [first, first + count) to buffers.
+     * Default implementation calls GetX/GetY for each point, derivate
+     * classes can override it to copy values directly from their storage.
+     * @param serie serie index
+     * @param first index of first point
+     * @param count point count
+     * @param xs buffer for x values, can be NULL if x values are not needed
+     * @param ys buffer for y values, can be NULL if y values are not needed
+     */
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys);
+
+    /**
+     * Returns pointer to contiguous x values of serie, if dataset
+     * stores them in such way. Pointer is valid until dataset is changed.
+     * Default implementation returns NULL.
+     * @param serie serie index
+     * @return pointer to x values, or NULL if dataset has no contiguous x values
+     */
+    virtual const double *GetXColumn(size_t serie);
+
+    /**
+     * Returns pointer to contiguous y values of serie, if dataset
+     * stores them in such way. Pointer is valid until dataset is changed.
+     * Default implementation returns NULL.
+     * @param serie serie index
+     * @return pointer to y values, or NULL if dataset has no contiguous y values
+     */
+    virtual const double *GetYColumn(size_t serie);
+
+    /**
+     * Declares that x values of all series are in ascending order.
+     * If not declared, order is detected by scanning serie once
+     * after each dataset change. Appends check appended points only.
+     * @param xSorted true if x values are in ascending order
+     */
+    void SetXSorted(bool xSorted);
+
+    /**
+     * Checks whether serie x values are in ascending order.
+     * @param serie serie index
+     * @return true if serie x values are in ascending order
+     */
+    virtual bool IsXSorted(size_t serie);
+
+    /**
+     * Finds range of serie points with x values in [xMin, xMax].
+     * Uses binary search for series with sorted x values, for
+     * unsorted series returns all points.
+     * @param serie serie index
+     * @param xMin minimal x value
+     * @param xMax maximal x value
+     * @param first output index of first point in range
+     * @param last output index of last point in range
+     * @return false if there is no points in range
+     */
+    bool IndexRangeForX(size_t serie, double xMin, double xMax, size_t &first, size_t &last);
+
+    /**
+     * Finds index of first point with x value not less than x
+     * (or greater than x, if upper is true) using binary search.
+     * Serie must have sorted x values.
+     * @param serie serie index
+     * @param x x value
+     * @param upper true to find first point with x value greater than x
+     * @return point index, or point count if there is no such point
+     */
+    size_t FindXIndex(size_t serie, double x, bool upper = false);
+
+    /**
+     * Sets whether to maintain range index for series y values.
+     * Range index allows to find minimal/maximal y values for x range
+     * in O(log N), it is built on first request and grows incrementally
+     * when points are appended. Y bounds are calculated with it too,
+     * so they are found quickly after extreme point is removed.
+     * @param useRangeIndex true to use range index
+     */
+    void SetUseRangeIndex(bool useRangeIndex);
+
+    bool GetUseRangeIndex() const
+    {
+        return m_useRangeIndex;
+    }
+
+    /**
+     * Returns minimal/maximal y values of all series points
+     * with x values in [xMin, xMax].
+     * @param xMin minimal x value
+     * @param xMax maximal x value
+     * @param yMin output minimal y value
+     * @param yMax output maximal y value
+     * @return false if there is no points in x range
+     */
+    bool GetYRangeForX(double xMin, double xMax, double &yMin, double &yMax);
+
     /**
      * Returns maximal y value.
      * @return maximal y value
@@ -76,7 +174,141 @@ public:
 protected:
     virtual bool AcceptRenderer(Renderer *r);
 
+    virtual bool CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue);
+
+    using Dataset::InvalidateBounds;
+
+    virtual void InvalidateBounds();
+
+    virtual void UpdateCaches(const DatasetChange &change);
+
+    /**
+     * Called by derivate classes when serie points are changed, inserted
+     * or removed, to drop range index summaries for them.
+     * Appended points don't need this call.
+     * @param serie serie index
+     * @param first index of first changed point
+     */
+    void InvalidateRangeIndex(size_t serie, size_t first);
+
+    /**
+     * Called by derivate classes when points are removed from serie start,
+     * so range index keeps summaries of remaining points.
+     * @param serie serie index
+     * @param count count of removed points
+     */
+    void RemoveRangeIndexFront(size_t serie, size_t count);
+
+private:
+    XYRangeIndex *GetRangeIndex(size_t serie);
+
+    void ClearRangeIndexes();
+
+    bool ScanXSorted(size_t serie, size_t first, size_t count);
+
+    bool m_xSorted;
+
+    bool m_useRangeIndex;
+    wxVector<XYRangeIndex *> m_rangeIndexes;
+
+    // detected x order for each serie: -1 unknown, 0 unsorted, 1 sorted
+    wxVector<int> m_xSortedCache;
+    unsigned long m_xSortedVersion;
+};
+
+/**
+ * Bulk access to serie values, used by renderers.
+ * Uses dataset columns directly when dataset provides them,
+ * otherwise copies values with XYDataset::GetXYBlock.
+ * Buffers are reused between Load calls.
+ */
+class WXDLLIMPEXP_FREECHART XYDataBlock
+{
+public:
+    XYDataBlock();
+    virtual ~XYDataBlock();
+
+    /**
+     * Loads values of serie points [first, first + count).
+     * @param dataset dataset
+     * @param serie serie index
+     * @param first index of first point
+     * @param count point count
+     */
+    void Load(XYDataset *dataset, size_t serie, size_t first, size_t count);
+
+    /**
+     * Loads values of all serie points.
+     * @param dataset dataset
+     * @param serie serie index
+     */
+    void Load(XYDataset *dataset, size_t serie)
+    {
+        Load(dataset, serie, 0, dataset->GetCount(serie));
+    }
+
+    /**
+     * Returns x values of loaded points.
+     * @return x values
+     */
+    const double *GetX() const
+    {
+        return m_xs;
+    }
+
+    /**
+     * Returns y values of loaded points.
+     * @return y values
+     */
+    const double *GetY() const
+    {
+        return m_ys;
+    }
+
+    /**
+     * Returns loaded point count.
+     * @return loaded point count
+     */
+    size_t GetCount() const
+    {
+        return m_count;
+    }
+
+    /**
+     * Translates loaded points to graphics coordinates.
+     * @param horizTransform transform of x values
+     * @param vertTransform transform of y values
+     */
+    void ToGraphics(const AxisTransform &horizTransform, const AxisTransform &vertTransform);
+
+    /**
+     * Returns x graphics coordinates, calculated by ToGraphics.
+     * @return x coordinates
+     */
+    const wxCoord *GetXCoords() const
+    {
+        return m_count != 0 ? &m_xCoords[0] : NULL;
+    }
+
+    /**
+     * Returns y graphics coordinates, calculated by ToGraphics.
+     * @return y coordinates
+     */
+    const wxCoord *GetYCoords() const
+    {
+        return m_count != 0 ? &m_yCoords[0] : NULL;
+    }
+
 private:
+    const double *m_xs;
+    const double *m_ys;
+    size_t m_count;
+
+    wxVector<double> m_xBuffer;
+    wxVector<double> m_yBuffer;
+
+    wxVector<wxCoord> m_xCoords;
+    wxVector<wxCoord> m_yCoords;
 };
 
 //
@@ -136,6 +136,13 @@ public:
 private:
     void SetDataset(XYDynamicDataset *dataset);
 
+    /**
+     * Updates dataset bounds with added points and notifies dataset.
+     * @param first index of first added point
+     * @param count count of added points
+     */
+    void DataAdded(size_t first, size_t count);
+
     wxRealPointArray    m_data;
     wxString             m_name;
     XYDynamicDataset    *m_dataset;
@@ -179,6 +186,8 @@ public:
     virtual double GetY(size_t index, size_t serie);
     virtual size_t GetCount(size_t serie);
 
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys);
+
 private:
     XYDynamicSerieArray m_series;
 };
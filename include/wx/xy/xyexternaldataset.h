@@ -0,0 +1,84 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xyexternaldataset.h
+// Purpose: xy dataset over caller owned records declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef XYEXTERNALDATASET_H_
+#define XYEXTERNALDATASET_H_
+
+#include <wx/xy/xydataset.h>
+#include <wx/externalbuffer.h>
+
+#include <wx/vector.h>
+
+/**
+ * XY dataset, that reads points from caller owned record buffer
+ * without copying. Each serie is pair of x and y fields of records,
+ * so interleaved records with several channels map to several series.
+ */
+class WXDLLIMPEXP_FREECHART XYExternalDataset : public XYDataset
+{
+    DECLARE_CLASS(XYExternalDataset)
+public:
+    /**
+     * Constructs new dataset.
+     * @param buffer record buffer, dataset takes ownership of it
+     */
+    XYExternalDataset(ExternalBuffer *buffer);
+    virtual ~XYExternalDataset();
+
+    /**
+     * Adds serie.
+     * @param name serie name
+     * @param xField x value field, or ExternalField::Index() to use record indexes
+     * @param yField y value field
+     */
+    void AddSerie(const wxString &name, const ExternalField &xField, const ExternalField &yField);
+
+    /**
+     * Makes more records of buffer valid. Called by buffer owner, after
+     * records were written in place after last valid one.
+     * @param count count of new valid records
+     */
+    void RecordsAppended(size_t count);
+
+    ExternalBuffer *GetBuffer()
+    {
+        return m_buffer;
+    }
+
+    virtual size_t GetSerieCount();
+
+    virtual wxString GetSerieName(size_t serie);
+
+    virtual size_t GetCount(size_t serie);
+
+    virtual double GetX(size_t index, size_t serie);
+
+    virtual double GetY(size_t index, size_t serie);
+
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys);
+
+    virtual const double *GetXColumn(size_t serie);
+
+    virtual const double *GetYColumn(size_t serie);
+
+    virtual bool IsXSorted(size_t serie);
+
+private:
+    struct Serie
+    {
+        wxString name;
+        ExternalField xField;
+        ExternalField yField;
+    };
+
+    ExternalBuffer *m_buffer;
+    wxVector<Serie> m_series;
+};
+
+#endif /* XYEXTERNALDATASET_H_ */
@@ -0,0 +1,198 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xyingestqueue.h
+// Purpose: thread safe xy sample queue and GUI thread drainer declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef XYINGESTQUEUE_H_
+#define XYINGESTQUEUE_H_
+
+#include <wx/wxfreechartdefs.h>
+#include <wx/dataset.h>
+
+#include <wx/thread.h>
+#include <wx/timer.h>
+#include <wx/vector.h>
+
+/**
+ * Bounded queue of xy samples. Any number of producer threads
+ * may push samples, while single consumer (GUI thread) pops them.
+ * Queue is guarded by critical section, that is held only to copy
+ * samples, so producers are never blocked by chart drawing.
+ * When queue is full, new samples are dropped and counted.
+ */
+class WXDLLIMPEXP_FREECHART XYIngestQueue
+{
+public:
+    /**
+     * Constructs new queue.
+     * @param capacity maximal sample count, rounded up to power of two
+     */
+    XYIngestQueue(size_t capacity);
+    virtual ~XYIngestQueue();
+
+    /**
+     * Pushes sample. Can be called from any thread.
+     * @param x x value
+     * @param y y value
+     * @return false if queue is full and sample was dropped
+     */
+    bool Push(double x, double y);
+
+    /**
+     * Pushes samples. Can be called from any thread.
+     * @param xs x values
+     * @param ys y values
+     * @param count sample count
+     * @return count of pushed samples, rest was dropped
+     */
+    size_t Push(const double *xs, const double *ys, size_t count);
+
+    /**
+     * Pops samples. Must be called only from consumer thread.
+     * @param xs output buffer for x values
+     * @param ys output buffer for y values
+     * @param maxCount buffers size
+     * @return count of popped samples
+     */
+    size_t Pop(double *xs, double *ys, size_t maxCount);
+
+    /**
+     * Returns count of samples dropped because queue was full.
+     * @return dropped sample count
+     */
+    size_t GetDropped();
+
+    size_t GetCapacity() const
+    {
+        return m_mask + 1;
+    }
+
+private:
+    bool PushLocked(double x, double y);
+
+    double *m_xs;
+    double *m_ys;
+    size_t m_mask;
+
+    wxCriticalSection m_lock;
+
+    // guarded by m_lock, positions are not wrapped
+    size_t m_enqueuePos;
+    size_t m_dequeuePos;
+    size_t m_dropped;
+
+    // non-copyable
+    XYIngestQueue(const XYIngestQueue &);
+    XYIngestQueue &operator=(const XYIngestQueue &);
+};
+
+/**
+ * Destination of drained samples.
+ */
+class WXDLLIMPEXP_FREECHART XYIngestTarget
+{
+public:
+    XYIngestTarget();
+    virtual ~XYIngestTarget();
+
+    /**
+     * Returns dataset, that is changed by Append.
+     * @return dataset
+     */
+    virtual Dataset *GetDataset() = 0;
+
+    /**
+     * Appends drained samples. Called on GUI thread.
+     * @param xs x values
+     * @param ys y values
+     * @param count sample count
+     */
+    virtual void Append(const double *xs, const double *ys, size_t count) = 0;
+};
+
+/**
+ * Ingest target for serie classes, that have
+ * Append(const double *xs, const double *ys, size_t count) method,
+ * such as XYColumnarSerie and XYRingBufferSerie.
+ */
+template<class S> class XYSerieIngestTarget : public XYIngestTarget
+{
+public:
+    XYSerieIngestTarget(Dataset *dataset, S *serie)
+    : m_dataset(dataset), m_serie(serie)
+    {
+    }
+
+    virtual Dataset *GetDataset()
+    {
+        return m_dataset;
+    }
+
+    virtual void Append(const double *xs, const double *ys, size_t count)
+    {
+        m_serie->Append(xs, ys, count);
+    }
+
+private:
+    Dataset *m_dataset;
+    S *m_serie;
+};
+
+/**
+ * Moves samples from ingest queues to datasets on GUI thread.
+ * Draining is done on timer (once per frame) or explicitly,
+ * and every changed dataset is notified once per drain.
+ */
+class WXDLLIMPEXP_FREECHART XYIngestDrainer : public wxEvtHandler
+{
+public:
+    XYIngestDrainer();
+    virtual ~XYIngestDrainer();
+
+    /**
+     * Adds queue to drain.
+     * @param queue queue, caller keeps ownership
+     * @param target samples destination, drainer takes ownership
+     */
+    void AddQueue(XYIngestQueue *queue, XYIngestTarget *target);
+
+    /**
+     * Starts draining on timer.
+     * @param interval timer interval in milliseconds, 16 is about 60 frames per second
+     */
+    void Start(int interval = 16);
+
+    /**
+     * Stops draining on timer.
+     */
+    void Stop();
+
+    /**
+     * Drains all queues now.
+     * @return count of drained samples
+     */
+    size_t Drain();
+
+private:
+    void OnTimer(wxTimerEvent &ev);
+
+    struct Entry
+    {
+        XYIngestQueue *queue;
+        XYIngestTarget *target;
+    };
+
+    wxVector<Entry> m_entries;
+    wxVector<double> m_xs;
+    wxVector<double> m_ys;
+
+    wxTimer m_timer;
+
+    DECLARE_EVENT_TABLE()
+};
+
+#endif /* XYINGESTQUEUE_H_ */
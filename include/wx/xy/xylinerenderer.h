@@ -50,6 +50,10 @@ public:
 
   virtual void Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
 
+    virtual bool CanRasterize(XYDataset *dataset);
+
+    virtual void Rasterize(ChartRaster &raster, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
     //
     // Renderer
     //
@@ -59,6 +63,16 @@ protected:
   virtual void DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset) = 0;
   virtual void DrawSymbols(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
 
+    /**
+     * Checks whether serie lines can be drawn by RasterizeLines.
+     * @param dataset dataset
+     * @return true if lines can be rasterized
+     */
+    virtual bool CanRasterizeLines(XYDataset *dataset);
+
+    virtual void RasterizeLines(ChartRaster &raster, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+    virtual void RasterizeSymbols(ChartRaster &raster, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
     bool m_drawSymbols;
     bool m_drawLines;
 
@@ -86,9 +100,37 @@ public:
     XYLineRenderer(bool drawSymbols = false, bool drawLines = true, int defaultWidth = 2, wxPenStyle defaultStyle = wxPENSTYLE_SOLID);
     virtual ~XYLineRenderer();
 
+    /**
+     * Sets whether to reduce line points in each pixel column to
+     * first, minimal, maximal and last ones before drawing.
+     * Line looks same, but drawing time depends on plot width,
+     * not on serie size. Disabled by default.
+     * @param decimation true to enable decimation
+     */
+    void SetDecimation(bool decimation);
+
+    /**
+     * Returns whether line points decimation is enabled.
+     * @return true if decimation is enabled
+     */
+    bool GetDecimation() const
+    {
+        return m_decimation;
+    }
 
 protected:
   virtual void DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
+    virtual bool CanRasterizeLines(XYDataset *dataset);
+
+    virtual void RasterizeLines(ChartRaster &raster, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
+private:
+    bool GetLinePoints(const wxRect &clip, wxRect rc, const AxisTransform &horizTransform,
+            const AxisTransform &vertTransform, Axis *horizAxis, XYDataset *dataset, size_t serie,
+            XYDataBlock &block, XYLinePoints &linePoints);
+
+    bool m_decimation;
 };
 
 /**
@@ -33,7 +33,11 @@ protected:
 
     virtual bool AcceptDataset(Dataset *dataset);
 
-    virtual void DrawDatasets(wxDC &dc, wxRect rc);
+    virtual void DrawDataset(wxDC &dc, wxRect rc, Dataset *dataset);
+
+    virtual bool CanRasterizeDataset(Dataset *dataset);
+
+    virtual void RasterizeDataset(ChartRaster &raster, wxRect rc, Dataset *dataset);
 
     /**
      * Draw single XY dataset.
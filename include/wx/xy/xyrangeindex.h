@@ -0,0 +1,91 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xyrangeindex.h
+// Purpose: range minimum/maximum index for xy series
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef XYRANGEINDEX_H_
+#define XYRANGEINDEX_H_
+
+#include <wx/xy/xydataset.h>
+
+/**
+ * Index for fast minimal/maximal y value lookup in range of serie points.
+ * Serie points are divided into blocks of fixed size, and block minimal/maximal
+ * values are stored in tree, where each level holds summaries of pairs
+ * from previous level. Range query takes O(log N) tree lookups plus scan of
+ * at most two partial blocks at range ends.
+ * Index grows incrementally when points are appended to serie, and
+ * keeps summaries of remaining points when points are removed from serie
+ * start, so it can be used with streaming (ring buffer) series.
+ */
+class WXDLLIMPEXP_FREECHART XYRangeIndex
+{
+public:
+    /**
+     * Constructs new range index.
+     * @param blockSize count of points summarized in one block
+     */
+    XYRangeIndex(size_t blockSize = 64);
+    virtual ~XYRangeIndex();
+
+    /**
+     * Drops summaries of points starting from index first.
+     * Called when serie points are changed.
+     * @param first index of first changed point
+     */
+    void Truncate(size_t first);
+
+    /**
+     * Shifts index after points are removed from serie start.
+     * Summaries of remaining points are kept, and summaries of removed
+     * points are released in batches, so removal takes amortized O(1).
+     * @param count count of removed points
+     */
+    void RemoveFront(size_t count);
+
+    /**
+     * Adds summaries for points appended to serie since last update.
+     * @param dataset dataset
+     * @param serie serie index
+     */
+    void Update(XYDataset *dataset, size_t serie);
+
+    /**
+     * Returns minimal/maximal y values for serie points [first, last].
+     * @param dataset dataset
+     * @param serie serie index
+     * @param first index of first point
+     * @param last index of last point
+     * @param minValue output minimal value
+     * @param maxValue output maximal value
+     * @return false if range is empty
+     */
+    bool GetMinMax(XYDataset *dataset, size_t serie, size_t first, size_t last,
+            double &minValue, double &maxValue);
+
+private:
+    void AddBlock(double minValue, double maxValue);
+
+    void Rebuild();
+
+    void ScanPoints(XYDataset *dataset, size_t serie, size_t first, size_t count,
+            double &minValue, double &maxValue, bool &hasValues);
+
+    size_t m_blockSize;
+
+    // position of first serie point in blocks, blocks before it
+    // hold summaries of removed points and are never used
+    size_t m_base;
+
+    // block summaries, level n holds summaries of 2^n blocks
+    wxVector<wxVector<double> > m_minValues;
+    wxVector<wxVector<double> > m_maxValues;
+
+    wxVector<double> m_buffer;
+};
+
+#endif /* XYRANGEINDEX_H_ */
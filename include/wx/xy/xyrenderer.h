@@ -13,6 +13,63 @@
 #include <wx/chartrenderer.h>
 #include <wx/axis/axis.h>
 #include <wx/xy/xydataset.h>
+#include <wx/chartraster.h>
+
+#include <vector>
+
+/**
+ * Collects serie line points in graphics coordinates.
+ * Consecutive equal points are dropped. In decimation mode each run of points
+ * in same pixel column is reduced to its first, minimal, maximal and last
+ * points (M4 decimation), so resulting line looks same, but point count
+ * depends on plot width rather than on serie size.
+ */
+class WXDLLIMPEXP_FREECHART XYLinePoints
+{
+public:
+    /**
+     * Constructs new line points collector.
+     * @param decimate true to reduce points in each pixel column
+     */
+    XYLinePoints(bool decimate = false);
+    virtual ~XYLinePoints();
+
+    /**
+     * Removes all points and prepares for new line.
+     * @param sizeHint expected point count
+     */
+    void Clear(size_t sizeHint = 0);
+
+    /**
+     * Adds next line point.
+     * @param pt point in graphics coordinates
+     */
+    void Add(const wxPoint &pt);
+
+    /**
+     * Returns collected points.
+     * @return collected points
+     */
+    std::vector<wxPoint> &GetPoints();
+
+private:
+    void Append(const wxPoint &pt);
+
+    void FlushColumn();
+
+    bool m_decimate;
+    std::vector<wxPoint> m_points;
+
+    // current pixel column state
+    bool m_hasColumn;
+    size_t m_columnCount;
+    wxPoint m_first;
+    wxPoint m_min;
+    wxPoint m_max;
+    wxPoint m_last;
+    size_t m_minIndex;
+    size_t m_maxIndex;
+};
 
 /**
  * Base class for all XYDataset renderers.
@@ -33,6 +90,61 @@ public:
      * @param dataset dataset to be drawn
      */
     virtual void Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset) = 0;
+
+    /**
+     * Checks whether dataset can be drawn by software rasterizer
+     * with current renderer settings.
+     * @param dataset dataset to be drawn
+     * @return true if Rasterize can draw dataset
+     */
+    virtual bool CanRasterize(XYDataset *dataset);
+
+    /**
+     * Draws dataset with software rasterizer. Output must match Draw
+     * with antialiasing turned off.
+     * @param raster rasterizer, clipped to rc
+     * @param rc rectangle where to draw
+     * @param horizAxis horizontal axis
+     * @param vertAxis vertical axis
+     * @param dataset dataset to be drawn
+     */
+    virtual void Rasterize(ChartRaster &raster, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset);
+
+protected:
+    /**
+     * Finds range of serie points, which x values are visible on horizontal axis.
+     * Range is narrowed to device context clipping box, so partial redraws
+     * load only points they draw. For series with unsorted x values
+     * returns all points.
+     * @param dc device context
+     * @param horizTransform horizontal axis transform
+     * @param horizAxis horizontal axis
+     * @param dataset dataset
+     * @param serie serie index
+     * @param first output index of first point
+     * @param count output point count
+     * @param extra count of points to include before and after visible range,
+     * line renderers use it to draw segments that cross plot edges
+     * @return false if there is no points to draw
+     */
+    bool GetVisibleRange(wxDC &dc, const AxisTransform &horizTransform, Axis *horizAxis,
+            XYDataset *dataset, size_t serie, size_t &first, size_t &count, size_t extra = 0);
+
+    /**
+     * Finds range of serie points, which x values are visible on horizontal axis
+     * and inside of clipping rectangle.
+     * @param clip clipping rectangle, empty for no clipping
+     * @param horizTransform horizontal axis transform
+     * @param horizAxis horizontal axis
+     * @param dataset dataset
+     * @param serie serie index
+     * @param first output index of first point
+     * @param count output point count
+     * @param extra count of points to include before and after visible range
+     * @return false if there is no points to draw
+     */
+    bool GetVisibleRange(const wxRect &clip, const AxisTransform &horizTransform, Axis *horizAxis,
+            XYDataset *dataset, size_t serie, size_t &first, size_t &count, size_t extra = 0);
 };
 
 #endif /*XYRENDERER_H_*/
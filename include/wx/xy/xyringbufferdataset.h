@@ -0,0 +1,223 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xyringbufferdataset.h
+// Purpose: xy ring buffer serie and dataset declaration
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef XYRINGBUFFERDATASET_H_
+#define XYRINGBUFFERDATASET_H_
+
+#include <wx/xy/xydataset.h>
+#include <wx/axis/axis.h>
+
+#include <wx/vector.h>
+
+class WXDLLIMPEXP_FREECHART XYRingBufferDataset;
+
+/**
+ * Streaming xy serie, that holds fixed count of newest points in ring buffer.
+ * When buffer is full, append evicts oldest point, so both operations take O(1).
+ * Optionally, points older than retention span (in x units) are evicted too.
+ * Points are accessed by logical index, where 0 is the oldest point.
+ */
+class WXDLLIMPEXP_FREECHART XYRingBufferSerie : public wxObject
+{
+    DECLARE_CLASS(XYRingBufferSerie)
+public:
+    friend class XYRingBufferDataset;
+
+    /**
+     * Constructs new ring buffer serie.
+     * @param capacity maximal point count
+     */
+    XYRingBufferSerie(size_t capacity);
+    virtual ~XYRingBufferSerie();
+
+    /**
+     * Changes buffer capacity. Newest points are kept.
+     * @param capacity new maximal point count
+     */
+    void SetCapacity(size_t capacity);
+
+    size_t GetCapacity() const
+    {
+        return m_xs.size();
+    }
+
+    /**
+     * Sets time based retention. Points with x value less than
+     * newest x value minus retention span are evicted on append.
+     * @param span retention span in x units, 0 to disable
+     */
+    void SetRetention(double span);
+
+    double GetRetention() const
+    {
+        return m_retention;
+    }
+
+    /**
+     * Appends point, evicting oldest points if needed.
+     * @param x x value
+     * @param y y value
+     */
+    void Append(double x, double y);
+
+    /**
+     * Appends range of points with one notification.
+     * @param xs x values
+     * @param ys y values
+     * @param count point count
+     */
+    void Append(const double *xs, const double *ys, size_t count);
+
+    /**
+     * Removes all points.
+     */
+    void Clear();
+
+    /**
+     * Returns x value at logical index.
+     * @param index point index, 0 is the oldest point
+     * @return x value
+     */
+    double GetX(size_t index) const
+    {
+        return m_xs[Physical(index)];
+    }
+
+    /**
+     * Returns y value at logical index.
+     * @param index point index, 0 is the oldest point
+     * @return y value
+     */
+    double GetY(size_t index) const
+    {
+        return m_ys[Physical(index)];
+    }
+
+    size_t GetCount() const
+    {
+        return m_count;
+    }
+
+    const wxString &GetName() const
+    {
+        return m_name;
+    }
+
+    void SetName(const wxString &name);
+
+private:
+    size_t Physical(size_t index) const
+    {
+        size_t n = m_head + index;
+        return (n >= m_xs.size()) ? n - m_xs.size() : n;
+    }
+
+    /**
+     * Copies values of logical points [first, first + count) to buffers.
+     */
+    void CopyValues(size_t first, size_t count, double *xs, double *ys) const;
+
+    void Push(double x, double y, size_t &evicted);
+
+    void EvictOldest();
+
+    void PointsAppended(size_t count, size_t evicted);
+
+    XYRingBufferDataset *m_dataset;
+
+    wxVector<double> m_xs;
+    wxVector<double> m_ys;
+    size_t m_head;
+    size_t m_count;
+
+    double m_retention;
+    bool m_xSorted;
+
+    wxString m_name;
+};
+
+/**
+ * XY dataset with ring buffer series, for strip charts of streaming data.
+ * Dataset can move window of horizontal axis to the newest points, so
+ * only visible part of buffer is drawn.
+ * Evicted points are reported as DATASET_CHANGE_REMOVE from serie start,
+ * and new points as DATASET_CHANGE_APPEND. Range index is used by default,
+ * it is shifted on eviction, so neither it nor y bounds are rebuilt.
+ */
+class WXDLLIMPEXP_FREECHART XYRingBufferDataset : public XYDataset, public AxisObserver
+{
+    DECLARE_CLASS(XYRingBufferDataset)
+public:
+    friend class XYRingBufferSerie;
+
+    XYRingBufferDataset();
+    virtual ~XYRingBufferDataset();
+
+    /**
+     * Adds serie to dataset. Dataset takes ownership of serie.
+     * @param serie serie to be added
+     */
+    void AddSerie(XYRingBufferSerie *serie);
+
+    XYRingBufferSerie *GetSerie(size_t serie);
+
+    /**
+     * Sets axis, which window follows newest points. Axis window is set
+     * to end at maximal x value after each append. Dataset does not own
+     * axis, and stops following it, when axis is destroyed.
+     * @param axis axis, or NULL to stop following
+     * @param winWidth window width; if 0, serie retention span is used, and
+     * if retention is not set, window covers all buffered points
+     */
+    void SetWindowAxis(Axis *axis, double winWidth = 0);
+
+    virtual size_t GetSerieCount();
+
+    virtual wxString GetSerieName(size_t serie);
+
+    virtual size_t GetCount(size_t serie);
+
+    virtual double GetX(size_t index, size_t serie);
+
+    virtual double GetY(size_t index, size_t serie);
+
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys);
+
+    virtual const double *GetXColumn(size_t serie);
+
+    virtual const double *GetYColumn(size_t serie);
+
+    virtual bool IsXSorted(size_t serie);
+
+    //
+    // AxisObserver
+    //
+    virtual void AxisChanged(Axis *axis);
+
+    virtual void BoundsChanged(Axis *axis);
+
+    virtual void AxisDestroyed(Axis *axis);
+
+protected:
+    virtual bool CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue);
+
+private:
+    size_t GetSerieIndex(XYRingBufferSerie *serie);
+
+    void PointsChanged(XYRingBufferSerie *serie, size_t removed, size_t appended);
+
+    void UpdateWindowAxis();
+
+    wxVector<XYRingBufferSerie *> m_series;
+
+    Axis *m_windowAxis;
+    double m_winWidth;
+};
+
+#endif /* XYRINGBUFFERDATASET_H_ */
@@ -55,6 +55,15 @@ public:
      * @return The Y value for the selected data point.
      */
     double GetY(size_t index);
+
+    /**
+     * Copies values of points [first, first + count) to buffers.
+     * @param first position of first data point
+     * @param count data point count
+     * @param xs buffer for X values, can be NULL
+     * @param ys buffer for Y values, can be NULL
+     */
+    void GetValues(size_t first, size_t count, double *xs, double *ys);
     
     /**
      * Updates the X value of an existing data point within the series.
@@ -121,6 +130,8 @@ public:
 
     virtual double GetY(size_t index, size_t serie) ;
 
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys);
+
     virtual size_t GetSerieCount();
 
     virtual size_t GetCount(size_t serie);
@@ -0,0 +1,577 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xytypeddataset.h
+// Purpose: reduced precision xy and time series datasets
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef XYTYPEDDATASET_H_
+#define XYTYPEDDATASET_H_
+
+#include <wx/xy/xydataset.h>
+
+#include <wx/vector.h>
+
+#include <limits>
+
+/**
+ * Column of values stored as raw type T (float, or integer type).
+ * Value is decoded as offset + scale * raw. Integer raw values are
+ * rounded and clamped to range of T (including infinities), when encoded.
+ * Integer types have no NaN, so NaN is encoded as 0, that is decoded
+ * as offset. Values out of float range are encoded as float infinities.
+ */
+template<typename T> class TypedColumn
+{
+public:
+    TypedColumn(double offset = 0, double scale = 1)
+    : m_offset(offset), m_scale(scale)
+    {
+    }
+
+    /**
+     * Sets decoding parameters. Must be called while column is empty.
+     * @param offset value offset
+     * @param scale value scale, must not be 0
+     */
+    void SetScale(double offset, double scale)
+    {
+        wxCHECK_RET(m_raw.empty() && scale != 0, wxT("TypedColumn::SetScale"));
+
+        m_offset = offset;
+        m_scale = scale;
+    }
+
+    double GetOffset() const
+    {
+        return m_offset;
+    }
+
+    double GetScale() const
+    {
+        return m_scale;
+    }
+
+    /**
+     * Converts value to raw type.
+     * @param value value
+     * @return raw value
+     */
+    T Encode(double value) const
+    {
+        double raw = (value - m_offset) / m_scale;
+
+        // conversion of NaN or value out of range of T is undefined
+        if (std::numeric_limits<T>::is_integer) {
+            if (raw != raw) {
+                return 0;
+            }
+            if (raw <= (double) std::numeric_limits<T>::min()) {
+                return std::numeric_limits<T>::min();
+            }
+            if (raw >= (double) std::numeric_limits<T>::max()) {
+                return std::numeric_limits<T>::max();
+            }
+            return (T) ((raw < 0) ? raw - 0.5 : raw + 0.5);
+        }
+
+        if (raw > (double) std::numeric_limits<T>::max()) {
+            return std::numeric_limits<T>::infinity();
+        }
+        if (raw < -(double) std::numeric_limits<T>::max()) {
+            return -std::numeric_limits<T>::infinity();
+        }
+        return (T) raw;
+    }
+
+    double Get(size_t index) const
+    {
+        return m_offset + m_scale * m_raw[index];
+    }
+
+    /**
+     * Decodes range of values.
+     * @param first index of first value
+     * @param count value count
+     * @param values output buffer
+     */
+    void Decode(size_t first, size_t count, double *values) const
+    {
+        const T *raw = &m_raw[first];
+        double offset = m_offset;
+        double scale = m_scale;
+
+        for (size_t n = 0; n < count; n++) {
+            values[n] = offset + scale * raw[n];
+        }
+    }
+
+    void Set(size_t index, double value)
+    {
+        m_raw[index] = Encode(value);
+    }
+
+    void Append(double value)
+    {
+        m_raw.push_back(Encode(value));
+    }
+
+    /**
+     * Appends raw values, that need no encoding.
+     * @param raw raw values
+     * @param count value count
+     */
+    void AppendRaw(const T *raw, size_t count)
+    {
+        m_raw.insert(m_raw.end(), raw, raw + count);
+    }
+
+    void Reserve(size_t count)
+    {
+        m_raw.reserve(count);
+    }
+
+    void Clear()
+    {
+        m_raw.clear();
+    }
+
+    size_t GetCount() const
+    {
+        return m_raw.size();
+    }
+
+    const T *GetRawData() const
+    {
+        return m_raw.empty() ? NULL : &m_raw[0];
+    }
+
+private:
+    wxVector<T> m_raw;
+    double m_offset;
+    double m_scale;
+};
+
+/**
+ * XY dataset, that stores x values as TX and y values as TY
+ * (see TypedColumn), to reduce memory used by large series.
+ * For example, XYTypedDataset<double, wxInt16> holds 16-bit samples
+ * with 10 bytes per point instead of 16.
+ */
+template<typename TX, typename TY> class XYTypedDataset : public XYDataset
+{
+public:
+    XYTypedDataset()
+    {
+    }
+
+    virtual ~XYTypedDataset()
+    {
+        for (size_t n = 0; n < m_series.size(); n++) {
+            wxDELETE(m_series[n]);
+        }
+    }
+
+    /**
+     * Adds new empty serie.
+     * @param name serie name
+     * @param yOffset y value offset
+     * @param yScale y value scale
+     * @param xOffset x value offset
+     * @param xScale x value scale
+     * @return index of added serie
+     */
+    size_t AddSerie(const wxString &name, double yOffset = 0, double yScale = 1,
+            double xOffset = 0, double xScale = 1)
+    {
+        Serie *serie = new Serie();
+        serie->name = name;
+        serie->xs.SetScale(xOffset, xScale);
+        serie->ys.SetScale(yOffset, yScale);
+        serie->xSorted = true;
+
+        m_series.push_back(serie);
+        DatasetChanged();
+        return m_series.size() - 1;
+    }
+
+    void Reserve(size_t serie, size_t count)
+    {
+        wxCHECK_RET(serie < m_series.size(), wxT("XYTypedDataset::Reserve"));
+
+        m_series[serie]->xs.Reserve(count);
+        m_series[serie]->ys.Reserve(count);
+    }
+
+    /**
+     * Appends point to serie. Values are encoded to storage types.
+     * @param serie serie index
+     * @param x x value
+     * @param y y value
+     */
+    void Append(size_t serie, double x, double y)
+    {
+        Append(serie, &x, &y, 1);
+    }
+
+    /**
+     * Appends range of points to serie with one notification.
+     * @param serie serie index
+     * @param xs x values
+     * @param ys y values
+     * @param count point count
+     */
+    void Append(size_t serie, const double *xs, const double *ys, size_t count)
+    {
+        wxCHECK_RET(serie < m_series.size(), wxT("XYTypedDataset::Append"));
+
+        Serie *s = m_series[serie];
+        size_t first = s->xs.GetCount();
+
+        for (size_t n = 0; n < count; n++) {
+            s->xs.Append(xs[n]);
+            s->ys.Append(ys[n]);
+        }
+        PointsAppended(serie, first);
+    }
+
+    /**
+     * Appends range of raw points, such as samples read from device,
+     * without encoding.
+     * @param serie serie index
+     * @param xs raw x values
+     * @param ys raw y values
+     * @param count point count
+     */
+    void AppendRaw(size_t serie, const TX *xs, const TY *ys, size_t count)
+    {
+        wxCHECK_RET(serie < m_series.size(), wxT("XYTypedDataset::AppendRaw"));
+
+        Serie *s = m_series[serie];
+        size_t first = s->xs.GetCount();
+
+        s->xs.AppendRaw(xs, count);
+        s->ys.AppendRaw(ys, count);
+        PointsAppended(serie, first);
+    }
+
+    /**
+     * Removes all points from serie.
+     * @param serie serie index
+     */
+    void Clear(size_t serie)
+    {
+        wxCHECK_RET(serie < m_series.size(), wxT("XYTypedDataset::Clear"));
+
+        m_series[serie]->xs.Clear();
+        m_series[serie]->ys.Clear();
+        m_series[serie]->xSorted = true;
+        DatasetChanged(DatasetChange(DATASET_CHANGE_CLEAR, serie));
+    }
+
+    void SetSerieName(size_t serie, const wxString &name)
+    {
+        wxCHECK_RET(serie < m_series.size(), wxT("XYTypedDataset::SetSerieName"));
+
+        m_series[serie]->name = name;
+        DatasetChanged(DatasetChange(DATASET_CHANGE_RENAME, serie), false);
+    }
+
+    const TypedColumn<TX> &GetXValues(size_t serie) const
+    {
+        return m_series[serie]->xs;
+    }
+
+    const TypedColumn<TY> &GetYValues(size_t serie) const
+    {
+        return m_series[serie]->ys;
+    }
+
+    virtual size_t GetSerieCount()
+    {
+        return m_series.size();
+    }
+
+    virtual wxString GetSerieName(size_t serie)
+    {
+        wxCHECK(serie < m_series.size(), wxEmptyString);
+        return m_series[serie]->name;
+    }
+
+    virtual size_t GetCount(size_t serie)
+    {
+        wxCHECK(serie < m_series.size(), 0);
+        return m_series[serie]->xs.GetCount();
+    }
+
+    virtual double GetX(size_t index, size_t serie)
+    {
+        wxCHECK(serie < m_series.size(), 0);
+        return m_series[serie]->xs.Get(index);
+    }
+
+    virtual double GetY(size_t index, size_t serie)
+    {
+        wxCHECK(serie < m_series.size(), 0);
+        return m_series[serie]->ys.Get(index);
+    }
+
+    virtual void GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys)
+    {
+        wxCHECK_RET(serie < m_series.size(), wxT("XYTypedDataset::GetXYBlock"));
+
+        Serie *s = m_series[serie];
+        wxCHECK_RET(first + count <= s->xs.GetCount(), wxT("XYTypedDataset::GetXYBlock"));
+
+        if (count == 0) {
+            return ;
+        }
+        if (xs != NULL) {
+            s->xs.Decode(first, count, xs);
+        }
+        if (ys != NULL) {
+            s->ys.Decode(first, count, ys);
+        }
+    }
+
+    virtual bool IsXSorted(size_t serie)
+    {
+        wxCHECK(serie < m_series.size(), false);
+        return m_series[serie]->xSorted;
+    }
+
+protected:
+    virtual bool CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue)
+    {
+        if (dim != BOUNDS_X && dim != BOUNDS_Y) {
+            return false;
+        }
+
+        // raw values are compared, and only extremes are decoded
+        bool hasValues = false;
+
+        for (size_t serie = 0; serie < m_series.size(); serie++) {
+            Serie *s = m_series[serie];
+            size_t count = s->xs.GetCount();
+            if (count == 0) {
+                continue;
+            }
+
+            double serieMin, serieMax;
+            if (dim == BOUNDS_X) {
+                RawBounds(s->xs, count, serieMin, serieMax);
+            }
+            else {
+                RawBounds(s->ys, count, serieMin, serieMax);
+            }
+
+            if (!hasValues) {
+                minValue = serieMin;
+                maxValue = serieMax;
+                hasValues = true;
+            }
+            else {
+                minValue = wxMin(minValue, serieMin);
+                maxValue = wxMax(maxValue, serieMax);
+            }
+        }
+        return hasValues;
+    }
+
+private:
+    struct Serie
+    {
+        TypedColumn<TX> xs;
+        TypedColumn<TY> ys;
+        wxString name;
+        bool xSorted;
+    };
+
+    template<typename T> static void RawBounds(const TypedColumn<T> &column, size_t count,
+            double &minValue, double &maxValue)
+    {
+        const T *raw = column.GetRawData();
+        T rawMin = raw[0];
+        T rawMax = raw[0];
+
+        for (size_t n = 1; n < count; n++) {
+            if (raw[n] < rawMin) {
+                rawMin = raw[n];
+            }
+            if (raw[n] > rawMax) {
+                rawMax = raw[n];
+            }
+        }
+
+        // negative scale reverses order
+        double v0 = column.GetOffset() + column.GetScale() * rawMin;
+        double v1 = column.GetOffset() + column.GetScale() * rawMax;
+        minValue = wxMin(v0, v1);
+        maxValue = wxMax(v0, v1);
+    }
+
+    void PointsAppended(size_t serie, size_t first)
+    {
+        Serie *s = m_series[serie];
+        size_t count = s->xs.GetCount();
+
+        for (size_t n = first; n < count; n++) {
+            double x = s->xs.Get(n);
+
+            if (s->xSorted && n > 0 && x < s->xs.Get(n - 1)) {
+                s->xSorted = false;
+            }
+            ExtendBounds(BOUNDS_X, x);
+            ExtendBounds(BOUNDS_Y, s->ys.Get(n));
+        }
+        DatasetChanged(DatasetChange(DATASET_CHANGE_APPEND, serie, first, count - first), false);
+    }
+
+    wxVector<Serie *> m_series;
+};
+
+/**
+ * Time series dataset, that stores values as TY (see TypedColumn) and
+ * times as 32-bit offsets in seconds from the first time.
+ * X values are indexes, like in TimeSeriesDataset.
+ */
+template<typename TY> class TypedTimeSeriesDataset : public XYDataset, public DateTimeDataset
+{
+public:
+    /**
+     * Constructs new time series dataset.
+     * @param offset value offset
+     * @param scale value scale
+     */
+    TypedTimeSeriesDataset(double offset = 0, double scale = 1)
+    : m_data(offset, scale)
+    {
+        SetXSorted(true); // x values are indexes
+    }
+
+    virtual ~TypedTimeSeriesDataset()
+    {
+    }
+
+    /**
+     * Appends value. Times must not be more than 2^31 seconds apart.
+     * @param time value time
+     * @param value value
+     */
+    void Append(time_t time, double value)
+    {
+        Append(&time, &value, 1);
+    }
+
+    /**
+     * Appends range of values with one notification.
+     * @param times value times
+     * @param values values
+     * @param count value count
+     */
+    void Append(const time_t *times, const double *values, size_t count)
+    {
+        if (count == 0) {
+            return ;
+        }
+        if (m_times.GetCount() == 0) {
+            m_times.SetScale((double) times[0], 1);
+        }
+
+        for (size_t n = 0; n < count; n++) {
+            m_times.Append((double) times[n]);
+            m_data.Append(values[n]);
+
+            size_t index = m_data.GetCount() - 1;
+            ExtendBounds(BOUNDS_X, index);
+            ExtendBounds(BOUNDS_Y, m_data.Get(index));
+        }
+        DatasetChanged(DatasetChange(DATASET_CHANGE_APPEND, 0, m_data.GetCount() - count, count), false);
+    }
+
+    void Reserve(size_t count)
+    {
+        m_times.Reserve(count);
+        m_data.Reserve(count);
+    }
+
+    void Clear()
+    {
+        m_times.Clear();
+        m_data.Clear();
+        DatasetChanged(DatasetChange(DATASET_CHANGE_CLEAR, 0));
+    }
+
+    virtual size_t GetSerieCount()
+    {
+        return 1;
+    }
+
+    virtual wxString GetSerieName(size_t WXUNUSED(serie))
+    {
+        return wxT("Time series");
+    }
+
+    virtual size_t GetCount(size_t WXUNUSED(serie))
+    {
+        return m_data.GetCount();
+    }
+
+    virtual double GetX(size_t index, size_t WXUNUSED(serie))
+    {
+        return index;
+    }
+
+    virtual double GetY(size_t index, size_t WXUNUSED(serie))
+    {
+        return m_data.Get(index);
+    }
+
+    virtual void GetXYBlock(size_t WXUNUSED(serie), size_t first, size_t count, double *xs, double *ys)
+    {
+        wxCHECK_RET(first + count <= m_data.GetCount(), wxT("TypedTimeSeriesDataset::GetXYBlock"));
+
+        if (xs != NULL) {
+            for (size_t n = 0; n < count; n++) {
+                xs[n] = first + n;
+            }
+        }
+        if (ys != NULL && count != 0) {
+            m_data.Decode(first, count, ys);
+        }
+    }
+
+    virtual DateTimeDataset *AsDateTimeDataset()
+    {
+        return this;
+    }
+
+    //
+    // DateTimeDataset
+    //
+    virtual time_t GetDate(size_t index)
+    {
+        return (time_t) m_times.Get(index);
+    }
+
+    virtual size_t GetCount()
+    {
+        return m_data.GetCount();
+    }
+
+private:
+    TypedColumn<wxInt32> m_times;
+    TypedColumn<TY> m_data;
+};
+
+typedef XYTypedDataset<double, float> XYFloatDataset;
+typedef XYTypedDataset<double, wxInt16> XYInt16Dataset;
+typedef XYTypedDataset<double, wxInt32> XYInt32Dataset;
+
+typedef TypedTimeSeriesDataset<float> FloatTimeSeriesDataset;
+typedef TypedTimeSeriesDataset<wxInt16> Int16TimeSeriesDataset;
+typedef TypedTimeSeriesDataset<wxInt32> Int32TimeSeriesDataset;
+
+#endif /* XYTYPEDDATASET_H_ */
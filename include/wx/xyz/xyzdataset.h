@@ -33,6 +33,9 @@ public:
     virtual double GetMinZ();
 
     virtual double GetMaxZ();
+
+protected:
+    virtual bool CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue);
 };
 
 #endif /*XYZDATASET_H_*/
@@ -28,7 +28,10 @@
 #include <math.h>
 
 // for dynamic demo5new
-#include "xyfastdataset.h"
+#include <wx/xy/xycolumnardataset.h>
+
+// for dynamic demo5
+#include <wx/xy/xyringbufferdataset.h>
 #include "marker.hpp"
 
 class XYDemo1 : public ChartDemo
@@ -189,6 +192,9 @@ public:
         // add our dataset to plot
         plot->AddDataset(dataset);
 
+        // draw symbols directly to bitmap pixels, when antialiasing is off
+        plot->SetSoftwareRaster(true);
+
         // create left and bottom number axes
         plot->AddAxis(new NumberAxis(AXIS_LEFT));
         plot->AddAxis(new NumberAxis(AXIS_BOTTOM));
@@ -280,9 +286,9 @@ public:
 class DynamicUpdater : public wxEvtHandler
 {
 public:
-    DynamicUpdater(XYSimpleDataset* dataset, NumberAxis* axis) :
+    DynamicUpdater(XYRingBufferDataset* dataset) :
     m_dataset(dataset),
-    m_axis(axis)
+    m_x(DYNAMIC_DATA_POINTS)
     {
         // Create a timer and bind to OnTimer event handler.
         m_timer.SetOwner(this);
@@ -299,27 +305,16 @@ public:
     }
 
 private:
-    XYSimpleDataset *m_dataset;
-    NumberAxis* m_axis;
+    XYRingBufferDataset *m_dataset;
+    double m_x;
     wxTimer m_timer;
     
     void OnTimer(wxTimerEvent &ev)
     {
-        double first_x = m_dataset->GetSerie(0)->GetX(0);
-        
-        // Ripple the values down the vector.
-        for (size_t i = 0; i < DYNAMIC_DATA_POINTS - 1; i++)
-            m_dataset->GetSerie(0)->UpdatePoint(i, wxRealPoint(first_x + i + 1, m_dataset->GetSerie(0)->GetY(i + 1)));
-
-        // Generate a new random value for the end point.
-        m_dataset->GetSerie(0)->UpdatePoint(DYNAMIC_DATA_POINTS - 1, 
-                                            wxPoint(first_x + DYNAMIC_DATA_POINTS + 1, (100.0 * rand() / (double) RAND_MAX)));
-                                            
-        // Shift the axis left also.
-        m_axis->SetFixedBounds(first_x + 1, first_x + DYNAMIC_DATA_POINTS);
-        
-        // Notify the chart of new data.
-        m_dataset->DatasetChanged();
+        // Append new random value, ring buffer evicts the oldest one
+        // and dataset moves axis window to the newest points.
+        m_dataset->GetSerie(0)->Append(m_x, 100.0 * rand() / (double) RAND_MAX);
+        m_x += 1;
     }
 };
 
@@ -336,20 +331,24 @@ public:
 
     virtual Chart *Create()
     {
-        // XY data for series.
-        wxVector<wxRealPoint> data;
-        
+        // Ring buffer serie, that keeps DYNAMIC_DATA_POINTS newest points.
+        XYRingBufferSerie *serie = new XYRingBufferSerie(DYNAMIC_DATA_POINTS);
+
         for (size_t i = 0; i < DYNAMIC_DATA_POINTS; i++)
-            data.push_back(wxRealPoint(i, 50));
+            serie->Append(i, 50);
 
         // First step: create plot.
         XYPlot *plot = new XYPlot();
 
+        // window advances by one point per frame, so previous frame
+        // is scrolled and only newest point is drawn
+        plot->SetStripChart(true);
+
         // Second step: create dataset
-        XYSimpleDataset *dataset = new XYSimpleDataset();
+        XYRingBufferDataset *dataset = new XYRingBufferDataset();
 
         // and add serie to it
-        dataset->AddSerie(new XYSerie(data));
+        dataset->AddSerie(serie);
 
         
         // set line renderer to it
@@ -372,9 +371,11 @@ public:
         leftAxis->SetFixedBounds(0.0, 100.0);
 
         NumberAxis *bottomAxis = new NumberAxis(AXIS_BOTTOM);
-        bottomAxis->SetFixedBounds(0.0, DYNAMIC_DATA_POINTS - 1);
         
-        m_pUpdater = new DynamicUpdater(dataset, bottomAxis);
+        // bottom axis window follows newest points
+        dataset->SetWindowAxis(bottomAxis, DYNAMIC_DATA_POINTS - 1);
+
+        m_pUpdater = new DynamicUpdater(dataset);
 
         // leftAxis->SetLabelCount(101);
         // leftAxis->SetLabelSkip(9);
@@ -415,7 +416,7 @@ private:
 class DynamicUpdaterNew : public wxEvtHandler
 {
 public:
-    DynamicUpdaterNew(XYFastDataset* dataset, NumberAxis* axis) :
+    DynamicUpdaterNew(XYColumnarDataset* dataset, NumberAxis* axis) :
         m_dataset(dataset),
         m_axis(axis)
     {
@@ -434,7 +435,7 @@ public:
     }
 
 private:
-    XYFastDataset *m_dataset;
+    XYColumnarDataset *m_dataset;
     NumberAxis* m_axis;
     wxTimer m_timer;
 
@@ -449,8 +450,10 @@ private:
         // Generate a new random value for the end point.
         //m_dataset->GetSerie(0)->UpdatePoint(DYNAMIC_DATA_POINTS - 1, 
         //                                    wxPoint(first_x + DYNAMIC_DATA_POINTS + 1, (100.0 * rand() / (double) RAND_MAX)));
-        m_dataset->GetSerie(0)->UpdateX(first_x + DYNAMIC_DATA_POINTS + 1);
-        m_dataset->GetSerie(0)->UpdateY((100.0 * rand() / (double)RAND_MAX));
+        // Batch all changes into one notification.
+        m_dataset->BeginUpdate();
+
+        m_dataset->GetSerie(0)->Shift(first_x + DYNAMIC_DATA_POINTS + 1, (100.0 * rand() / (double)RAND_MAX));
 
         // Shift the axis left also.
         m_axis->SetFixedBounds(first_x + 1, first_x + DYNAMIC_DATA_POINTS);
@@ -492,10 +495,10 @@ public:
         XYPlot *plot = new XYPlot();
 
         // Second step: create dataset
-        XYFastDataset *dataset = new XYFastDataset();
+        XYColumnarDataset *dataset = new XYColumnarDataset();
 
         // and add serie to it
-        dataset->AddSerie(new XYFastSerie(data));
+        dataset->AddSerie(new XYColumnarSerie(data));
 
 
         // set line renderer to it
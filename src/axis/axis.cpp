@@ -22,12 +22,16 @@ AxisObserver::~AxisObserver()
 {
 }
 
+void AxisObserver::AxisDestroyed(Axis *WXUNUSED(axis))
+{
+}
+
 Axis::Axis(AXIS_LOCATION location)
 {
     m_location = location;
 
-    m_majorGridlinePen = *wxThePenList->FindOrCreatePen(DEFAULT_MAJOR_GRIDLINE_PEN_COLOUR, 1, wxPENSTYLE_SOLID); // wxPENSTYLE_DOT);//wxPENSTYLE_SHORT_DASH);
-    m_minorGridlinePen = *wxThePenList->FindOrCreatePen(DEFAULT_MINOR_GRIDLINE_PEN_COLOUR, 1, wxPENSTYLE_SOLID); // wxPENSTYLE_DOT);//wxPENSTYLE_SHORT_DASH);
+    m_majorGridlinePen = *DrawResources::FindOrCreatePen(DEFAULT_MAJOR_GRIDLINE_PEN_COLOUR, 1, wxPENSTYLE_SOLID); // wxPENSTYLE_DOT);//wxPENSTYLE_SHORT_DASH);
+    m_minorGridlinePen = *DrawResources::FindOrCreatePen(DEFAULT_MINOR_GRIDLINE_PEN_COLOUR, 1, wxPENSTYLE_SOLID); // wxPENSTYLE_DOT);//wxPENSTYLE_SHORT_DASH);
 
     m_winPos = 0;
     m_winWidth = 0;
@@ -41,6 +45,7 @@ Axis::Axis(AXIS_LOCATION location)
 
 Axis::~Axis()
 {
+    FireAxisDestroyed();
 }
 
 void Axis::SetMargins(wxCoord marginMin, wxCoord marginMax)
@@ -75,6 +80,17 @@ bool Axis::IsVisible(double value)
     }
 }
 
+void Axis::GetVisibleBounds(double &minValue, double &maxValue)
+{
+    if (m_useWin) {
+        minValue = m_winPos;
+        maxValue = m_winPos + m_winWidth;
+    }
+    else {
+        GetDataBounds(minValue, maxValue);
+    }
+}
+
 bool Axis::IntersectsWindow(double v0, double v1)
 {
     if (m_useWin) {
@@ -109,6 +125,16 @@ double Axis::BoundValue(double value)
 }
 
 wxCoord Axis::ToGraphics(wxDC& WXUNUSED(dc), int minCoord, int gRange, double value)
+{
+    return GetLinearTransform(minCoord, gRange).ToGraphics(value);
+}
+
+AxisTransform Axis::GetTransform(int minCoord, int gRange)
+{
+    return GetLinearTransform(minCoord, gRange);
+}
+
+AxisTransform Axis::GetLinearTransform(int minCoord, int gRange)
 {
     double minValue, maxValue;
     GetDataBounds(minValue, maxValue);
@@ -124,7 +150,7 @@ wxCoord Axis::ToGraphics(wxDC& WXUNUSED(dc), int minCoord, int gRange, double va
         maxValue = m_winPos + m_winWidth;
     }
 
-    return ::ToGraphics(minCoord, gRange, minValue, maxValue, 0/*textMargin*/, IsVertical(), value);
+    return AxisTransform(minCoord, gRange, minValue, maxValue, IsVertical());
 }
 
 double Axis::ToData(wxDC& WXUNUSED(dc), int minCoord, int gRange, wxCoord g)
@@ -195,6 +221,11 @@ bool AxisShare::IsVisible(double value)
     return m_axis->IsVisible(value);
 }
 
+void AxisShare::GetVisibleBounds(double &minValue, double &maxValue)
+{
+    m_axis->GetVisibleBounds(minValue, maxValue);
+}
+
 double AxisShare::BoundValue(double value)
 {
     return m_axis->BoundValue(value);
@@ -205,6 +236,11 @@ wxCoord AxisShare::ToGraphics(wxDC &dc, int minCoord, int gRange, double value)
     return m_axis->ToGraphics(dc, minCoord, gRange, value);
 }
 
+AxisTransform AxisShare::GetTransform(int minCoord, int gRange)
+{
+    return m_axis->GetTransform(minCoord, gRange);
+}
+
 double AxisShare::ToData(wxDC &dc, int minCoord, int gRange, wxCoord g)
 {
     return m_axis->ToData(dc, minCoord, gRange, g);
@@ -0,0 +1,284 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    axistransform.cpp
+// Purpose: data to graphics coordinates transform implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/axis/axistransform.h>
+
+#include <float.h>
+#include <string.h>
+
+#include <limits>
+
+#if defined(__AVX__)
+#define AXIS_TRANSFORM_AVX
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define AXIS_TRANSFORM_SSE2
+#include <emmintrin.h>
+#endif
+
+// values are mapped by blocks of this size, before affine transform
+#define AXIS_TRANSFORM_BLOCK 256
+
+// log2(x) = e + log2(m), where x = m * 2^e and m is in [sqrt(0.5), sqrt(2)).
+// ln(m) = 2 * atanh(f), f = (m - 1) / (m + 1), |f| <= 0.172, and atanh series
+// up to f^11 gives error below 1e-10, which is far below pixel size
+#define LOG2_SQRT2 1.4142135623730951
+#define LOG2_2LOG2E 2.8853900817779268 // 2 / ln(2)
+#define LOG2_C1 (1.0 / 3)
+#define LOG2_C2 (1.0 / 5)
+#define LOG2_C3 (1.0 / 7)
+#define LOG2_C4 (1.0 / 9)
+#define LOG2_C5 (1.0 / 11)
+
+#define LOG2_MANTISSA_MASK wxULL(0x000FFFFFFFFFFFFF)
+#define LOG2_EXPONENT_ONE wxULL(0x3FF0000000000000)
+#define LOG2_EXPONENT_MAGIC wxULL(0x4330000000000000) // 2^52, low bits hold integer
+
+// NAN macro is C99, so it is missing in older math.h
+static inline double QuietNaN()
+{
+    return std::numeric_limits<double>::quiet_NaN();
+}
+
+double AxisTransform::Log2(double value)
+{
+    if (!(value > 0)) {
+        return QuietNaN();
+    }
+
+    // denormals are treated as smallest normal value
+    value = (value > DBL_MIN) ? value : DBL_MIN;
+    value = (value < DBL_MAX) ? value : DBL_MAX;
+
+    wxUint64 bits;
+    memcpy(&bits, &value, sizeof(bits));
+
+    double e = (double) (int) ((bits >> 52) & 0x7FF) - 1023;
+
+    bits = (bits & LOG2_MANTISSA_MASK) | LOG2_EXPONENT_ONE;
+    double m;
+    memcpy(&m, &bits, sizeof(m));
+
+    if (m > LOG2_SQRT2) {
+        m = m * 0.5;
+        e = e + 1;
+    }
+
+    double f = (m - 1) / (m + 1);
+    double z = f * f;
+    double p = LOG2_C5;
+    p = p * z + LOG2_C4;
+    p = p * z + LOG2_C3;
+    p = p * z + LOG2_C2;
+    p = p * z + LOG2_C1;
+    p = p * z + 1;
+    return e + f * p * LOG2_2LOG2E;
+}
+
+/**
+ * Calculates logs[i] = AxisTransform::Log2(values[i]).
+ * values and logs can be same array.
+ */
+static void Log2Values(const double *values, double *logs, size_t count)
+{
+    size_t n = 0;
+
+#if defined(AXIS_TRANSFORM_SSE2)
+    const __m128d vZero = _mm_setzero_pd();
+    const __m128d vMinNormal = _mm_set1_pd(DBL_MIN);
+    const __m128d vMaxValue = _mm_set1_pd(DBL_MAX);
+    const __m128d vNaN = _mm_set1_pd(QuietNaN());
+    const __m128d vOne = _mm_set1_pd(1.0);
+    const __m128d vHalf = _mm_set1_pd(0.5);
+    const __m128d vSqrt2 = _mm_set1_pd(LOG2_SQRT2);
+    const __m128d vBias = _mm_set1_pd(1023.0 + 4503599627370496.0); // 1023 + 2^52
+    const __m128i vMantissaMask = _mm_set1_epi64x((wxInt64) LOG2_MANTISSA_MASK);
+    const __m128i vExponentOne = _mm_set1_epi64x((wxInt64) LOG2_EXPONENT_ONE);
+    const __m128i vExponentMagic = _mm_set1_epi64x((wxInt64) LOG2_EXPONENT_MAGIC);
+
+    for (; n + 2 <= count; n += 2) {
+        __m128d x = _mm_loadu_pd(values + n);
+        __m128d positive = _mm_cmpgt_pd(x, vZero);
+
+        x = _mm_min_pd(_mm_max_pd(x, vMinNormal), vMaxValue);
+        __m128i bits = _mm_castpd_si128(x);
+
+        // exponent: put biased exponent to low mantissa bits of 2^52
+        __m128i biased = _mm_srli_epi64(bits, 52);
+        __m128d e = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(biased, vExponentMagic)), vBias);
+
+        __m128d m = _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(bits, vMantissaMask), vExponentOne));
+
+        __m128d big = _mm_cmpgt_pd(m, vSqrt2);
+        m = _mm_or_pd(_mm_and_pd(big, _mm_mul_pd(m, vHalf)), _mm_andnot_pd(big, m));
+        e = _mm_add_pd(e, _mm_and_pd(big, vOne));
+
+        __m128d f = _mm_div_pd(_mm_sub_pd(m, vOne), _mm_add_pd(m, vOne));
+        __m128d z = _mm_mul_pd(f, f);
+        __m128d p = _mm_set1_pd(LOG2_C5);
+        p = _mm_add_pd(_mm_mul_pd(p, z), _mm_set1_pd(LOG2_C4));
+        p = _mm_add_pd(_mm_mul_pd(p, z), _mm_set1_pd(LOG2_C3));
+        p = _mm_add_pd(_mm_mul_pd(p, z), _mm_set1_pd(LOG2_C2));
+        p = _mm_add_pd(_mm_mul_pd(p, z), _mm_set1_pd(LOG2_C1));
+        p = _mm_add_pd(_mm_mul_pd(p, z), vOne);
+
+        __m128d r = _mm_add_pd(e, _mm_mul_pd(_mm_mul_pd(f, p), _mm_set1_pd(LOG2_2LOG2E)));
+
+        // not positive values (and NaN) give NaN
+        r = _mm_or_pd(_mm_and_pd(positive, r), _mm_andnot_pd(positive, vNaN));
+        _mm_storeu_pd(logs + n, r);
+    }
+#endif
+
+    for (; n < count; n++) {
+        logs[n] = AxisTransform::Log2(values[n]);
+    }
+}
+
+/**
+ * Calculates coords[i] = (wxCoord) clamp(values[i] * scale + offset).
+ * Conversion truncates toward zero, as scalar cast does.
+ */
+static void TransformAffine(const double *values, wxCoord *coords, size_t count, double scale, double offset)
+{
+    size_t n = 0;
+
+#if defined(AXIS_TRANSFORM_AVX)
+    const __m256d vScale = _mm256_set1_pd(scale);
+    const __m256d vOffset = _mm256_set1_pd(offset);
+    const __m256d vMin = _mm256_set1_pd(-AXIS_TRANSFORM_COORD_LIMIT);
+    const __m256d vMax = _mm256_set1_pd(AXIS_TRANSFORM_COORD_LIMIT);
+
+    for (; n + 4 <= count; n += 4) {
+        __m256d g = _mm256_add_pd(_mm256_mul_pd(_mm256_loadu_pd(values + n), vScale), vOffset);
+        // max returns second operand for NaN, so NaN goes to lower limit
+        g = _mm256_min_pd(_mm256_max_pd(g, vMin), vMax);
+        _mm_storeu_si128((__m128i *) (coords + n), _mm256_cvttpd_epi32(g));
+    }
+#elif defined(AXIS_TRANSFORM_SSE2)
+    const __m128d vScale = _mm_set1_pd(scale);
+    const __m128d vOffset = _mm_set1_pd(offset);
+    const __m128d vMin = _mm_set1_pd(-AXIS_TRANSFORM_COORD_LIMIT);
+    const __m128d vMax = _mm_set1_pd(AXIS_TRANSFORM_COORD_LIMIT);
+
+    for (; n + 4 <= count; n += 4) {
+        __m128d g0 = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(values + n), vScale), vOffset);
+        __m128d g1 = _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(values + n + 2), vScale), vOffset);
+        g0 = _mm_min_pd(_mm_max_pd(g0, vMin), vMax);
+        g1 = _mm_min_pd(_mm_max_pd(g1, vMin), vMax);
+
+        // each conversion gives two integers in low half
+        __m128i i0 = _mm_cvttpd_epi32(g0);
+        __m128i i1 = _mm_cvttpd_epi32(g1);
+        _mm_storeu_si128((__m128i *) (coords + n), _mm_unpacklo_epi64(i0, i1));
+    }
+#endif
+
+    for (; n < count; n++) {
+        double g = values[n] * scale + offset;
+
+        g = (g > -AXIS_TRANSFORM_COORD_LIMIT) ? g : -AXIS_TRANSFORM_COORD_LIMIT;
+        g = (g < AXIS_TRANSFORM_COORD_LIMIT) ? g : AXIS_TRANSFORM_COORD_LIMIT;
+        coords[n] = (wxCoord) g;
+    }
+}
+
+AxisTransform::AxisTransform()
+{
+    m_scale = 0;
+    m_offset = 0;
+    m_log = false;
+    m_map = NULL;
+    m_mapData = NULL;
+}
+
+AxisTransform::AxisTransform(int minCoord, int gRange, double minValue, double maxValue, bool vertical)
+{
+    m_log = false;
+    m_map = NULL;
+    m_mapData = NULL;
+
+    Init(minCoord, gRange, minValue, maxValue, vertical);
+}
+
+AxisTransform AxisTransform::Log(int minCoord, int gRange, double minValue, double maxValue, bool vertical)
+{
+    // logarithm base does not change relative position of value
+    // between bounds, so base 2 logarithm is used for all bases
+    AxisTransform transform(minCoord, gRange, Log2(minValue), Log2(maxValue), vertical);
+    transform.m_log = true;
+    return transform;
+}
+
+void AxisTransform::Init(int minCoord, int gRange, double minValue, double maxValue, bool vertical)
+{
+    double valueRange = maxValue - minValue;
+
+    if (gRange <= 0 || valueRange == 0) {
+        m_scale = 0;
+        m_offset = minCoord;
+    }
+    else if (vertical) {
+        m_scale = -gRange / valueRange;
+        m_offset = minCoord - maxValue * m_scale;
+    }
+    else {
+        m_scale = gRange / valueRange;
+        m_offset = minCoord - minValue * m_scale;
+    }
+}
+
+void AxisTransform::SetValueMap(AxisValueMap map, void *userData)
+{
+    m_map = map;
+    m_mapData = userData;
+}
+
+void AxisTransform::ToGraphics(const double *values, wxCoord *coords, size_t count) const
+{
+    if (m_map == NULL && !m_log) {
+        TransformAffine(values, coords, count, m_scale, m_offset);
+        return ;
+    }
+
+    double mapped[AXIS_TRANSFORM_BLOCK];
+
+    for (size_t first = 0; first < count; first += AXIS_TRANSFORM_BLOCK) {
+        size_t blockCount = wxMin(count - first, (size_t) AXIS_TRANSFORM_BLOCK);
+        const double *block = values + first;
+
+        if (m_map != NULL) {
+            for (size_t n = 0; n < blockCount; n++) {
+                mapped[n] = m_map(block[n], m_mapData);
+            }
+            block = mapped;
+        }
+        if (m_log) {
+            Log2Values(block, mapped, blockCount);
+            block = mapped;
+        }
+
+        TransformAffine(block, coords + first, blockCount, m_scale, m_offset);
+    }
+}
+
+double AxisTransform::ToData(wxCoord g) const
+{
+    if (m_scale == 0) {
+        return 0;
+    }
+
+    double value = (g - m_offset) / m_scale;
+    if (m_log) {
+        value = pow(2.0, value);
+    }
+    return value;
+}
@@ -68,6 +68,9 @@ bool CategoryAxis::UpdateBounds()
         }
     }
 
+    // category names can change with data
+    InvalidateTicks();
+
     FireBoundsChanged();
     return true;
 }
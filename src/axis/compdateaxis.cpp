@@ -10,6 +10,10 @@
 #include "wx/axis/compdateaxis.h"
 #include <wx/arrimpl.cpp>
 
+#include <math.h>
+
+#include <limits>
+
 WX_DEFINE_EXPORTED_OBJARRAY(wxDateSpanArray);
 WX_DEFINE_EXPORTED_OBJARRAY(wxTimeSpanArray);
 
@@ -84,7 +88,104 @@ wxDateTime::Month MonthFromNum(int month)
     }
 }
 
-int Mod(wxDateTime::wxDateTime_t d, int size)
+/**
+ * Local calendar date, used for span arithmetic without wxDateTime stepping.
+ */
+struct CivilDate
+{
+    int year;
+    int month; // 1-12
+    int day; // 1-31
+};
+
+/**
+ * Returns number of days since 1970-01-01 for calendar date.
+ */
+static long DaysFromCivil(const CivilDate &date)
+{
+    // shift year start to March, so leap day is last day of year
+    long year = date.year - (date.month <= 2 ? 1 : 0);
+    long era = (year >= 0 ? year : year - 399) / 400;
+    long yearOfEra = year - era * 400;
+    long dayOfYear = (153 * (date.month + (date.month > 2 ? -3 : 9)) + 2) / 5 + date.day - 1;
+    long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+/**
+ * Returns calendar date for number of days since 1970-01-01.
+ */
+static CivilDate CivilFromDays(long days)
+{
+    days += 719468;
+    long era = (days >= 0 ? days : days - 146096) / 146097;
+    long dayOfEra = days - era * 146097;
+    long yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    long dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    long monthPos = (5 * dayOfYear + 2) / 153;
+
+    CivilDate date;
+    date.day = (int) (dayOfYear - (153 * monthPos + 2) / 5 + 1);
+    date.month = (int) (monthPos < 10 ? monthPos + 3 : monthPos - 9);
+    date.year = (int) (yearOfEra + era * 400 + (date.month <= 2 ? 1 : 0));
+    return date;
+}
+
+static int DaysInMonth(int year, int month)
+{
+    static const int days[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+
+    if (month == 2 && (year % 4 == 0 && (year % 100 != 0 || year % 400 == 0))) {
+        return 29;
+    }
+    return days[month - 1];
+}
+
+static CivilDate ToCivil(const wxDateTime &date)
+{
+    CivilDate civil;
+    civil.year = date.GetYear();
+    civil.month = MonthNum(date.GetMonth());
+    civil.day = date.GetDay();
+    return civil;
+}
+
+static wxDateTime FromCivil(const CivilDate &date)
+{
+    return wxDateTime((wxDateTime::wxDateTime_t) date.day, MonthFromNum(date.month), date.year);
+}
+
+/**
+ * Returns approximate span length in days.
+ */
+static double SpanDays(const wxDateSpan &span)
+{
+    return span.GetTotalDays() + (span.GetYears() * 12 + span.GetMonths()) * 30.436875;
+}
+
+/**
+ * Adds count spans to date. Years and months are added first,
+ * with day clamped to month length, then days, as wxDateTime does.
+ */
+static CivilDate AddSpans(CivilDate date, const wxDateSpan &span, long count)
+{
+    long months = (span.GetYears() * 12L + span.GetMonths()) * count;
+    if (months != 0) {
+        long monthNum = date.year * 12L + (date.month - 1) + months;
+
+        date.year = (int) (monthNum / 12);
+        date.month = (int) (monthNum % 12) + 1;
+        date.day = wxMin(date.day, DaysInMonth(date.year, date.month));
+    }
+
+    long days = (long) span.GetTotalDays() * count;
+    if (days != 0) {
+        date = CivilFromDays(DaysFromCivil(date) + days);
+    }
+    return date;
+}
+
+static int Mod(int d, int size)
 {
     if (size == 0) {
         return 0;
@@ -92,17 +193,40 @@ int Mod(wxDateTime::wxDateTime_t d, int size)
     return d % size;
 }
 
-wxDateTime RoundDateToSpan(wxDateTime date, wxDateSpan span)
+static CivilDate RoundDateToSpan(CivilDate date, const wxDateSpan &span)
 {
-    wxDateTime::wxDateTime_t day = date.GetDay();
-    int month = MonthNum(date.GetMonth());
-    wxDateTime::wxDateTime_t year = date.GetYear();
+    date.day -= Mod(date.day - 1, span.GetTotalDays());
+    date.month -= Mod(date.month - 1, span.GetMonths());
+    date.year -= Mod(date.year, span.GetYears());
+    return date;
+}
 
-    wxDateTime::wxDateTime_t modDays = Mod(day - 1, span.GetTotalDays());
-    wxDateTime::wxDateTime_t modMonths = Mod(month - 1, span.GetMonths());
-    wxDateTime::wxDateTime_t modYears = Mod(year, span.GetYears());
+/**
+ * Returns greatest number of spans, that can be added to start date,
+ * so result does not exceed last day.
+ * @param start start date
+ * @param span span
+ * @param lastDay last day number
+ * @return number of spans
+ */
+static long FindLastSpan(const CivilDate &start, const wxDateSpan &span, long lastDay)
+{
+    double spanDays = SpanDays(span);
+    if (spanDays <= 0) {
+        return 0;
+    }
 
-    return wxDateTime(day - modDays, MonthFromNum(month - modMonths), year - modYears);
+    long count = (long) floor((lastDay - DaysFromCivil(start)) / spanDays);
+    count = wxMax(count, 0L);
+
+    // estimate is off by few spans at most, because of variable month length
+    while (count > 0 && DaysFromCivil(AddSpans(start, span, count)) > lastDay) {
+        count--;
+    }
+    while (DaysFromCivil(AddSpans(start, span, count + 1)) <= lastDay) {
+        count++;
+    }
+    return count;
 }
 
 /**
@@ -112,17 +236,10 @@ wxDateTime RoundDateToSpan(wxDateTime date, wxDateSpan span)
  * @param span span
  * @return number of spans in date interval
  */
-int NumOfSpans(wxDateTime first, wxDateTime last, wxDateSpan span)
+static long NumOfSpans(const wxDateTime &first, const wxDateTime &last, const wxDateSpan &span)
 {
-    int count = 0;
-
-    wxDateTime date = RoundDateToSpan(first, span);
-    do {
-        date += span;
-        count++;
-    } while (date <= last);
-
-    return count;
+    CivilDate start = RoundDateToSpan(ToCivil(first), span);
+    return FindLastSpan(start, span, DaysFromCivil(ToCivil(last))) + 1;
 }
 
 wxString FormatInterval(int start, int end)
@@ -148,6 +265,15 @@ CompDateAxis::CompDateAxis(AXIS_LOCATION location)
     m_labelColour = *wxBLACK;
 
     m_dateCount = 0;
+
+    m_dateRangeValid = false;
+    m_firstDay = 0;
+    m_firstDate = 0;
+    m_lastDate = 0;
+
+    m_spanLayoutValid = false;
+    m_layoutWinMin = 0;
+    m_layoutWinMax = 0;
 }
 
 CompDateAxis::~CompDateAxis()
@@ -177,6 +303,8 @@ void CompDateAxis::GetDataBounds(double &minValue, double &maxValue) const
 bool CompDateAxis::UpdateBounds()
 {
     m_dateCount = 0;
+    m_dateRangeValid = false;
+    m_spanLayoutValid = false;
 
     DateTimeDataset *dataset = m_datasets[0]->AsDateTimeDataset();
     if (dataset->GetCount() < 1) {
@@ -192,7 +320,7 @@ bool CompDateAxis::UpdateBounds()
 
     wxDateSpan span = m_dateSpans[0]; // take first span as minimal
 
-    m_dateCount = NumOfSpans(wxDateTime(minDate), wxDateTime(maxDate), span);
+    m_dateCount = (size_t) NumOfSpans(wxDateTime(minDate), wxDateTime(maxDate), span);
 
     FireBoundsChanged();
     
@@ -201,22 +329,18 @@ bool CompDateAxis::UpdateBounds()
 
 void CompDateAxis::DrawGridLines(wxDC &dc, wxRect rc)
 {
-    wxDateTime firstDate, lastDate;
-    if (!GetWindowDateBounds(firstDate, lastDate)) {
-        return ;
-    }
+    UpdateSpanLayout();
 
     // we will draw grid lines by minimal date span
-    wxDateSpan span;
-    if (!GetMinSpan(span)) {
+    if (m_spanLayout.size() == 0) {
         return ;
     }
+    const SpanRow &row = m_spanLayout[0];
 
     dc.SetPen(m_majorGridlinePen);
 
-    wxDateTime date = RoundDateToSpan(firstDate, span);
-    do {
-        double value = DateToDataCoord(date);
+    for (size_t n = 0; n < row.size(); n++) {
+        double value = row[n].start;
 
         wxCoord x0, y0;
         wxCoord x1, y1;
@@ -232,9 +356,7 @@ void CompDateAxis::DrawGridLines(wxDC &dc, wxRect rc)
         }
 
         dc.DrawLine(x0, y0, x1, y1);
-
-        date += span;
-    } while (date <= lastDate);
+    }
 }
 
 void CompDateAxis::Draw(wxDC &dc, wxRect rc)
@@ -244,31 +366,77 @@ void CompDateAxis::Draw(wxDC &dc, wxRect rc)
         return ; // BUG!
     }
 
-    wxDateTime firstDate, lastDate;
-    if (!GetWindowDateBounds(firstDate, lastDate)) {
+    UpdateSpanLayout();
+
+    for (size_t nSpan = 0; nSpan < m_spanLayout.size(); nSpan++) {
+        const SpanRow &row = m_spanLayout[nSpan];
+
+        for (size_t n = 0; n < row.size(); n++) {
+            DrawSpan(dc, rc, nSpan, row[n].label, row[n].start, row[n].end);
+        }
+    }
+}
+
+void CompDateAxis::UpdateSpanLayout()
+{
+    double winMin, winMax;
+    GetWindowBounds(winMin, winMax);
+
+    if (m_spanLayoutValid && winMin == m_layoutWinMin && winMax == m_layoutWinMax) {
         return ;
     }
 
+    m_spanLayout.clear();
+    m_spanLayoutValid = true;
+    m_layoutWinMin = winMin;
+    m_layoutWinMax = winMax;
+
+    wxDateSpan minSpan;
+    if (!GetMinSpan(minSpan) || !UpdateDateRange()) {
+        return ;
+    }
+
+    int firstDateIndex = (int) winMin;
+    int lastDateIndex = RoundHigh(winMax) - 1;
+    if (lastDateIndex < firstDateIndex) {
+        lastDateIndex = firstDateIndex;
+    }
+
+    // window bounds are in minimal spans from first date
+    CivilDate firstDate = CivilFromDays(m_firstDay);
+    CivilDate windowStart = AddSpans(firstDate, minSpan, firstDateIndex);
+    long lastDay = DaysFromCivil(AddSpans(firstDate, minSpan, lastDateIndex));
+
+    m_spanLayout.resize(m_dateSpans.Count());
+
     for (size_t nSpan = 0; nSpan < m_dateSpans.Count(); nSpan++) {
-        wxDateSpan span = m_dateSpans[nSpan];
+        const wxDateSpan &span = m_dateSpans[nSpan];
+        if (SpanDays(span) <= 0) {
+            continue;
+        }
 
-        wxDateTime dateStart = RoundDateToSpan(firstDate, span);
-        do {
-            double start = DateToDataCoord(dateStart);
+        CivilDate start = RoundDateToSpan(windowStart, span);
+        long count = FindLastSpan(start, span, lastDay) + 1;
 
-            wxDateTime dateEnd = dateStart;
-            dateEnd += span;
+        SpanRow &row = m_spanLayout[nSpan];
+        row.reserve(count);
 
-            double end = DateToDataCoord(dateEnd);
+        wxDateTime cellStart = FromCivil(start);
+        for (long n = 0; n < count; n++) {
+            wxDateTime cellEnd = FromCivil(AddSpans(start, span, n + 1));
 
-            DrawSpan(dc, rc, nSpan, GetSpanLabel(dateStart, span), start, end);
+            SpanCell cell;
+            cell.start = DateToDataCoord(cellStart.GetTicks());
+            cell.end = DateToDataCoord(cellEnd.GetTicks());
+            cell.label = GetSpanLabel(cellStart, span);
+            row.push_back(cell);
 
-            dateStart += span;
-        } while (dateStart <= lastDate);
+            cellStart = cellEnd;
+        }
     }
 }
 
-void CompDateAxis::DrawSpan(wxDC &dc, wxRect rcAxis, int spanNum, wxString spanLabel, double start, double end)
+void CompDateAxis::DrawSpan(wxDC &dc, wxRect rcAxis, int spanNum, const wxString &spanLabel, double start, double end)
 {
     double winMin, winMax;
     GetWindowBounds(winMin, winMax);
@@ -385,12 +553,37 @@ wxCoord CompDateAxis::ToGraphics(wxDC &dc, int minCoord, int gRange, double valu
         return 0;
     }
 
-    wxDateTime date(dataset->GetDate((int) value));
-    value = DateToDataCoord(date);
+    value = DateToDataCoord(dataset->GetDate(index));
 
     return Axis::ToGraphics(dc, minCoord, gRange, value);
 }
 
+AxisTransform CompDateAxis::GetTransform(int minCoord, int gRange)
+{
+    AxisTransform transform = GetLinearTransform(minCoord, gRange);
+    transform.SetValueMap(MapDateIndex, this);
+    return transform;
+}
+
+double CompDateAxis::MapDateIndex(double value, void *axis)
+{
+    CompDateAxis *dateAxis = (CompDateAxis *) axis;
+
+    DateTimeDataset *dataset = NULL;
+    if (dateAxis->m_datasets.Count() != 0) {
+        dataset = dateAxis->m_datasets[0]->AsDateTimeDataset();
+    }
+
+    // range is checked before cast, which is undefined for negative values and NaN
+    if (dataset == NULL || !(value >= 0) || value >= (double) dataset->GetCount()) {
+        return std::numeric_limits<double>::quiet_NaN(); // out of range, mapped outside of plot
+    }
+
+    size_t index = (size_t) value;
+
+    return dateAxis->DateToDataCoord(dataset->GetDate(index));
+}
+
 double CompDateAxis::ToData(wxDC &dc, int minCoord, int gRange, wxCoord g)
 {
     double value = Axis::ToData(dc, minCoord, gRange, g);
@@ -469,58 +662,17 @@ wxCoord CompDateAxis::GetSpanExtent(wxDC &dc)
     return spanExtent;
 }
 
-bool CompDateAxis::GetWindowDateBounds(wxDateTime &date0, wxDateTime &date1)
+bool CompDateAxis::UpdateDateRange()
 {
-    double winMin, winMax;
-    GetWindowBounds(winMin, winMax);
-
-    int firstDateIndex = (int) winMin;
-    int lastDateIndex = RoundHigh(winMax) - 1;
-    if (lastDateIndex < firstDateIndex) {
-        lastDateIndex = firstDateIndex;
-    }
-
-    wxDateSpan span;
-    if (!GetMinSpan(span)) {
-        return false;
+    if (m_dateRangeValid) {
+        return true;
     }
 
-    wxDateTime date;
-    if (!GetFirstDate(date)) {
-        return false;
-    }
-
-    date0 = date;
-    for (int n = 0; n < firstDateIndex; n++) {
-        date0 += span;
-    }
-
-    date1 = date;
-    for (int n = 0; n < lastDateIndex; n++) {
-        date1 += span;
-    }
-    return true;
-}
-
-bool CompDateAxis::GetFirstDate(wxDateTime &date)
-{
-    wxDateTime dummy;
-    return GetFirstLastDate(date, dummy);
-}
-
-bool CompDateAxis::GetLastDate(wxDateTime &date)
-{
-    wxDateTime dummy;
-    return GetFirstLastDate(dummy, date);
-}
-
-bool CompDateAxis::GetFirstLastDate(wxDateTime &firstDate, wxDateTime &lastDate)
-{
     if (m_datasets.Count() == 0) {
         return false;
     }
     DateTimeDataset *dataset = m_datasets[0]->AsDateTimeDataset();
-    if (dataset == NULL) {
+    if (dataset == NULL || dataset->GetCount() == 0) {
         return false; // BUG
     }
 
@@ -529,13 +681,18 @@ bool CompDateAxis::GetFirstLastDate(wxDateTime &firstDate, wxDateTime &lastDate)
         return false;
     }
 
-    firstDate = RoundDateToSpan(dataset->GetDate(0), span);
+    CivilDate firstDate = RoundDateToSpan(ToCivil(wxDateTime(dataset->GetDate(0))), span);
+    m_firstDay = DaysFromCivil(firstDate);
+    m_firstDate = FromCivil(firstDate).GetTicks();
 
-    lastDate = dataset->GetDate(dataset->GetCount() - 1);
-    wxDateTime date = RoundDateToSpan(lastDate, span);
+    wxDateTime lastDate(dataset->GetDate(dataset->GetCount() - 1));
+    wxDateTime date = FromCivil(RoundDateToSpan(ToCivil(lastDate), span));
     if (date < lastDate) {
         lastDate += span;
     }
+    m_lastDate = lastDate.GetTicks();
+
+    m_dateRangeValid = true;
     return true;
 }
 
@@ -548,19 +705,20 @@ bool CompDateAxis::GetMinSpan(wxDateSpan &span)
     return true;
 }
 
-double CompDateAxis::DateToDataCoord(wxDateTime &date)
+double CompDateAxis::DateToDataCoord(time_t date)
 {
-    wxDateTime firstDate, lastDate;
-    if (!GetFirstLastDate(firstDate, lastDate)) {
+    if (!UpdateDateRange() || m_lastDate == m_firstDate) {
         return 0;
     }
 
-    double dataValue = m_dateCount * (double) (date.GetTicks() - firstDate.GetTicks()) / (double) (lastDate.GetTicks() - firstDate.GetTicks());
+    double dataValue = m_dateCount * (double) (date - m_firstDate) / (double) (m_lastDate - m_firstDate);
     return dataValue;
 }
 
 void CompDateAxis::AddInterval(const wxDateSpan &interval)
 {
     m_dateSpans.Add(interval);
+    m_dateRangeValid = false;
+    m_spanLayoutValid = false;
     FireAxisChanged();
 }
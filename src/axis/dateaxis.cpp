@@ -9,6 +9,184 @@
 
 #include <wx/axis/dateaxis.h>
 
+#include <math.h>
+
+// maximal tick count for visible window
+#define DATE_AXIS_MAX_TICKS 10
+
+enum DATE_TICK_UNIT {
+    DATE_TICK_SECOND,
+    DATE_TICK_MINUTE,
+    DATE_TICK_HOUR,
+    DATE_TICK_DAY,
+    DATE_TICK_MONTH,
+    DATE_TICK_YEAR
+};
+
+/**
+ * Calendar step between ticks.
+ */
+struct DateTickStep
+{
+    DATE_TICK_UNIT unit;
+    int count;
+    double seconds; // approximate step length
+};
+
+#define DAY_SECONDS (24.0 * 60 * 60)
+
+static const DateTickStep dateTickSteps[] = {
+    { DATE_TICK_SECOND, 1, 1 },
+    { DATE_TICK_SECOND, 2, 2 },
+    { DATE_TICK_SECOND, 5, 5 },
+    { DATE_TICK_SECOND, 10, 10 },
+    { DATE_TICK_SECOND, 15, 15 },
+    { DATE_TICK_SECOND, 30, 30 },
+    { DATE_TICK_MINUTE, 1, 60 },
+    { DATE_TICK_MINUTE, 2, 2 * 60 },
+    { DATE_TICK_MINUTE, 5, 5 * 60 },
+    { DATE_TICK_MINUTE, 10, 10 * 60 },
+    { DATE_TICK_MINUTE, 15, 15 * 60 },
+    { DATE_TICK_MINUTE, 30, 30 * 60 },
+    { DATE_TICK_HOUR, 1, 60 * 60 },
+    { DATE_TICK_HOUR, 2, 2 * 60 * 60 },
+    { DATE_TICK_HOUR, 3, 3 * 60 * 60 },
+    { DATE_TICK_HOUR, 6, 6 * 60 * 60 },
+    { DATE_TICK_HOUR, 12, 12 * 60 * 60 },
+    { DATE_TICK_DAY, 1, DAY_SECONDS },
+    { DATE_TICK_DAY, 2, 2 * DAY_SECONDS },
+    { DATE_TICK_DAY, 7, 7 * DAY_SECONDS },
+    { DATE_TICK_MONTH, 1, 30.44 * DAY_SECONDS },
+    { DATE_TICK_MONTH, 2, 2 * 30.44 * DAY_SECONDS },
+    { DATE_TICK_MONTH, 3, 3 * 30.44 * DAY_SECONDS },
+    { DATE_TICK_MONTH, 6, 6 * 30.44 * DAY_SECONDS },
+    { DATE_TICK_YEAR, 1, 365.25 * DAY_SECONDS },
+    { DATE_TICK_YEAR, 2, 2 * 365.25 * DAY_SECONDS },
+    { DATE_TICK_YEAR, 5, 5 * 365.25 * DAY_SECONDS },
+    { DATE_TICK_YEAR, 10, 10 * 365.25 * DAY_SECONDS },
+    { DATE_TICK_YEAR, 20, 20 * 365.25 * DAY_SECONDS },
+    { DATE_TICK_YEAR, 50, 50 * 365.25 * DAY_SECONDS },
+    { DATE_TICK_YEAR, 100, 100 * 365.25 * DAY_SECONDS },
+};
+
+/**
+ * Returns smallest step, that gives no more than DATE_AXIS_MAX_TICKS
+ * ticks for date span.
+ */
+static const DateTickStep &SelectDateTickStep(double span)
+{
+    size_t count = WXSIZEOF(dateTickSteps);
+
+    for (size_t n = 0; n < count; n++) {
+        if (span / dateTickSteps[n].seconds <= DATE_AXIS_MAX_TICKS) {
+            return dateTickSteps[n];
+        }
+    }
+    return dateTickSteps[count - 1];
+}
+
+/**
+ * Rounds date down to step boundary in local time.
+ */
+static time_t AlignDate(time_t date, const DateTickStep &step)
+{
+    wxDateTime dt(date);
+
+    int year = dt.GetYear();
+    int month = dt.GetMonth();
+    int day = dt.GetDay();
+    int hour = dt.GetHour();
+    int minute = dt.GetMinute();
+    int second = dt.GetSecond();
+
+    switch (step.unit) {
+    case DATE_TICK_YEAR:
+        year -= year % step.count;
+        month = wxDateTime::Jan;
+        day = 1;
+        hour = minute = second = 0;
+        break;
+    case DATE_TICK_MONTH:
+        month -= month % step.count;
+        day = 1;
+        hour = minute = second = 0;
+        break;
+    case DATE_TICK_DAY:
+        day -= (day - 1) % step.count;
+        hour = minute = second = 0;
+        break;
+    case DATE_TICK_HOUR:
+        hour -= hour % step.count;
+        minute = second = 0;
+        break;
+    case DATE_TICK_MINUTE:
+        minute -= minute % step.count;
+        second = 0;
+        break;
+    case DATE_TICK_SECOND:
+        second -= second % step.count;
+        break;
+    }
+
+    dt.Set(day, (wxDateTime::Month) month, year, hour, minute, second);
+    return dt.GetTicks();
+}
+
+/**
+ * Returns next step boundary after date, that is on step boundary.
+ */
+static time_t NextDate(time_t date, const DateTickStep &step)
+{
+    wxDateTime dt(date);
+
+    switch (step.unit) {
+    case DATE_TICK_YEAR:
+        dt += wxDateSpan(step.count);
+        break;
+    case DATE_TICK_MONTH:
+        dt += wxDateSpan(0, step.count);
+        break;
+    case DATE_TICK_DAY:
+        dt += wxDateSpan(0, 0, 0, step.count);
+        break;
+    case DATE_TICK_HOUR:
+        dt += wxTimeSpan(step.count);
+        break;
+    case DATE_TICK_MINUTE:
+        dt += wxTimeSpan(0, step.count);
+        break;
+    case DATE_TICK_SECOND:
+        dt += wxTimeSpan(0, 0, step.count);
+        break;
+    }
+
+    // day steps are restarted from first day of each month
+    time_t next = AlignDate(dt.GetTicks(), step);
+    if (next <= date) {
+        next = dt.GetTicks(); // daylight saving time change
+    }
+    return next;
+}
+
+/**
+ * Returns index of first date not less than specified,
+ * searching in range [first, last).
+ */
+static size_t FindDateIndex(DateTimeDataset *dataset, time_t date, size_t first, size_t last)
+{
+    while (first < last) {
+        size_t middle = first + (last - first) / 2;
+
+        if (dataset->GetDate(middle) < date) {
+            first = middle + 1;
+        }
+        else {
+            last = middle;
+        }
+    }
+    return first;
+}
+
 IMPLEMENT_CLASS(DateAxis, Axis)
 
 DateAxis::DateAxis(AXIS_LOCATION location)
@@ -16,6 +194,10 @@ DateAxis::DateAxis(AXIS_LOCATION location)
 {
     m_dateFormat = wxT("%d %m");
     m_dateCount = 0;
+
+    m_tickIndexesValid = false;
+    m_tickWinMin = 0;
+    m_tickWinMax = 0;
 }
 
 DateAxis::~DateAxis()
@@ -41,6 +223,10 @@ bool DateAxis::UpdateBounds()
         dateCount = wxMax(dateCount, count);
     }
 
+    // labels are taken from dataset dates, which can change with data
+    m_tickIndexesValid = false;
+    InvalidateTicks();
+
     if (dateCount != m_dateCount) {
         m_dateCount = dateCount;
         FireBoundsChanged();
@@ -79,9 +265,71 @@ void DateAxis::GetDataBounds(double &minValue, double &maxValue) const
     }
 }
 
+void DateAxis::PrepareTicks()
+{
+    double winMin, winMax;
+    GetVisibleBounds(winMin, winMax);
+
+    if (m_tickIndexesValid && winMin == m_tickWinMin && winMax == m_tickWinMax) {
+        return ;
+    }
+
+    m_tickIndexes.clear();
+    m_tickIndexesValid = true;
+    m_tickWinMin = winMin;
+    m_tickWinMax = winMax;
+    InvalidateTicks();
+
+    if (m_datasets.Count() == 0 || m_dateCount == 0) {
+        return ;
+    }
+
+    DateTimeDataset *dataset = m_datasets[0]->AsDateTimeDataset();
+
+    winMin = wxMax(ceil(winMin), 0.0);
+    winMax = wxMin(floor(winMax), (double) (m_dateCount - 1));
+    if (winMin > winMax) {
+        return ;
+    }
+
+    size_t first = (size_t) winMin;
+    size_t last = (size_t) winMax;
+
+    time_t firstDate = dataset->GetDate(first);
+    time_t lastDate = dataset->GetDate(last);
+
+    const DateTickStep &step = SelectDateTickStep(difftime(lastDate, firstDate));
+
+    // find first date on or after each step boundary, so tick count
+    // depends only on visible date span
+    size_t index = first;
+    for (time_t date = AlignDate(firstDate, step); date <= lastDate; date = NextDate(date, step)) {
+        if (date < firstDate) {
+            continue;
+        }
+
+        index = FindDateIndex(dataset, date, index, last + 1);
+        if (index > last) {
+            break;
+        }
+
+        // several boundaries can fall into gap between dates
+        if (m_tickIndexes.size() == 0 || m_tickIndexes.back() != index) {
+            m_tickIndexes.push_back(index);
+        }
+    }
+
+    if (m_tickIndexes.size() == 0) {
+        m_tickIndexes.push_back(first);
+    }
+}
+
 double DateAxis::GetValue(size_t step)
 {
-    return step;
+    if (step < m_tickIndexes.size()) {
+        return m_tickIndexes[step];
+    }
+    return m_dateCount; // end of last tick interval
 }
 
 void DateAxis::GetLabel(size_t step, wxString &label)
@@ -92,11 +340,11 @@ void DateAxis::GetLabel(size_t step, wxString &label)
     }
 
     wxDateTime dt;
-    dt.Set(dataset->GetDate(step));
+    dt.Set(dataset->GetDate(m_tickIndexes[step]));
     label = dt.Format(m_dateFormat);
 }
 
 bool DateAxis::IsEnd(size_t step)
 {
-    return step >= m_dateCount;
+    return step >= m_tickIndexes.size();
 }
@@ -22,6 +22,7 @@ JulianDateAxis::~JulianDateAxis()
 void JulianDateAxis::SetDateFormat(const wxString& dateFormat)
 {
    m_dateFormat = dateFormat;
+   InvalidateTicks();
    FireAxisChanged();
 }
 
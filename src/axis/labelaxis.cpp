@@ -63,6 +63,13 @@ LabelAxis::LabelAxis(AXIS_LOCATION location)
     m_blankLabels = 0;
 
     m_labelColourer = new DefaultLabelColourer();
+
+    m_ticksValid = false;
+    m_ticksMinValue = 0;
+    m_ticksMaxValue = 0;
+    m_tickExtentsValid = false;
+    m_labelCoords.valid = false;
+    m_gridCoords.valid = false;
 }
 
 LabelAxis::~LabelAxis()
@@ -72,7 +79,10 @@ LabelAxis::~LabelAxis()
 
 wxCoord LabelAxis::GetExtent(wxDC &dc)
 {
-    wxSize maxLabelExtent = GetLongestLabelExtent(dc);
+    UpdateTicks();
+    MeasureTicks(dc);
+
+    wxSize maxLabelExtent = m_longestLabelExtent;
     wxCoord extent = m_labelLineSize + m_labelGap;
 
     wxSize titleExtent;
@@ -118,61 +128,159 @@ int LabelAxis::GetLabelSkip()
     return m_blankLabels;
 }
 
-void LabelAxis::DrawLabels(wxDC &dc, wxRect rc)
+void LabelAxis::PrepareTicks()
 {
-    if (!HasLabels())
-        return ;
+}
 
-    // Setup dc objects for labels and tick mark lines.
-    dc.SetFont(m_labelTextFont);
-    dc.SetTextForeground(m_labelTextColour);
-    dc.SetPen(m_labelPen);
+void LabelAxis::UpdateTicks()
+{
+    PrepareTicks();
 
-    wxString label;
-    
-    for (int majorStep = 0; !IsEnd(majorStep); majorStep++) 
-    {
-        double value = GetValue(majorStep);
-        
-        if (!IsVisible(value))
-            continue;
+    double minValue, maxValue;
+    GetDataBounds(minValue, maxValue);
 
-        label = wxEmptyString;
+    if (m_ticksValid && minValue == m_ticksMinValue && maxValue == m_ticksMaxValue) {
+        return ;
+    }
+
+    m_ticks.clear();
+
+    for (size_t majorStep = 0; !IsEnd(majorStep); majorStep++) {
+        Tick tick;
+        tick.value = GetValue(majorStep);
+        tick.isMajor = true;
 
         // Get the value for this step as a string (can be number, category etc. depending on derivative).
-        GetLabel(majorStep, label);
+        GetLabel(majorStep, tick.label);
+        m_ticks.push_back(tick);
 
-        // Draw a tick and label at the major interval.
-        DrawLabel(dc, rc, label, value, true);
+        if (m_minorIntervalCount == 0) {
+            continue;
+        }
 
         // Calculate the value range between this label and the next (changes for non-linear axis, such as log).
-        double minorInterval =  (GetValue(majorStep + 1) - GetValue(majorStep)) / m_minorIntervalCount;
-        
-        for (size_t minorStep = 1; minorStep <= m_minorIntervalCount; minorStep++)
-        {
-            double minorValue = GetValue(majorStep) + (minorInterval * minorStep);
-
-            if (!IsVisible(minorValue))
-                continue;
-            
-            // Draw the minor interval tick.
-            DrawLabel(dc, rc, "", minorValue, false);
+        double minorInterval = (GetValue(majorStep + 1) - tick.value) / m_minorIntervalCount;
+
+        Tick minorTick;
+        minorTick.isMajor = false;
+
+        for (size_t minorStep = 1; minorStep <= m_minorIntervalCount; minorStep++) {
+            minorTick.value = tick.value + (minorInterval * minorStep);
+            m_ticks.push_back(minorTick);
+        }
+    }
+
+    m_ticksValid = true;
+    m_ticksMinValue = minValue;
+    m_ticksMaxValue = maxValue;
+
+    m_tickExtentsValid = false;
+    m_labelCoords.valid = false;
+    m_gridCoords.valid = false;
+}
+
+void LabelAxis::MeasureTicks(wxDC &dc)
+{
+    TextMeasureKey measureKey(dc);
+
+    if (m_tickExtentsValid && measureKey == m_tickExtentsKey) {
+        return ;
+    }
+
+    m_longestLabelExtent = GetLongestLabelExtent(dc);
+
+    dc.SetFont(m_labelTextFont);
+    for (size_t n = 0; n < m_ticks.size(); n++) {
+        if (m_ticks[n].isMajor) {
+            m_ticks[n].extent = dc.GetTextExtent(m_ticks[n].label);
+        }
+    }
+
+    m_tickExtentsValid = true;
+    m_tickExtentsKey = measureKey;
+}
+
+void LabelAxis::UpdateTickCoords(TickCoords &tickCoords, int minCoord, int gRange)
+{
+    double visibleMin, visibleMax;
+    GetVisibleBounds(visibleMin, visibleMax);
+
+    if (tickCoords.valid && tickCoords.minCoord == minCoord && tickCoords.gRange == gRange
+            && tickCoords.visibleMin == visibleMin && tickCoords.visibleMax == visibleMax
+            && tickCoords.marginMin == m_marginMin && tickCoords.marginMax == m_marginMax) {
+        return ;
+    }
+
+    tickCoords.ticks.clear();
+    tickCoords.coords.clear();
+
+    AxisTransform transform = GetTransform(minCoord, gRange);
+    bool majorVisible = false;
+
+    for (size_t n = 0; n < m_ticks.size(); n++) {
+        const Tick &tick = m_ticks[n];
+
+        // minor ticks are shown only after visible major tick
+        bool visible = IsVisible(tick.value);
+        if (tick.isMajor) {
+            majorVisible = visible;
+        }
+        else {
+            visible = visible && majorVisible;
+        }
+
+        if (visible) {
+            tickCoords.ticks.push_back(n);
+            tickCoords.coords.push_back(transform.ToGraphics(tick.value));
         }
     }
+
+    tickCoords.valid = true;
+    tickCoords.minCoord = minCoord;
+    tickCoords.gRange = gRange;
+    tickCoords.visibleMin = visibleMin;
+    tickCoords.visibleMax = visibleMax;
+    tickCoords.marginMin = m_marginMin;
+    tickCoords.marginMax = m_marginMax;
 }
 
-void LabelAxis::DrawLabel(wxDC &dc, wxRect rc, const wxString &label, double value, bool isMajorLabel)
+void LabelAxis::DrawLabels(wxDC &dc, wxRect rc)
 {
-    wxSize labelExtent = dc.GetTextExtent(label);
+    if (!HasLabels())
+        return ;
+
+    UpdateTicks();
+    MeasureTicks(dc);
+
+    if (IsVertical()) {
+        UpdateTickCoords(m_labelCoords, rc.y, rc.height);
+    }
+    else {
+        UpdateTickCoords(m_labelCoords, rc.x, rc.width);
+    }
+
+    // Setup dc objects for labels and tick mark lines.
+    dc.SetFont(m_labelTextFont);
+    dc.SetTextForeground(m_labelTextColour);
+    dc.SetPen(m_labelPen);
+
+    for (size_t n = 0; n < m_labelCoords.ticks.size(); n++) {
+        DrawLabel(dc, rc, m_ticks[m_labelCoords.ticks[n]], m_labelCoords.coords[n]);
+    }
+}
+
+void LabelAxis::DrawLabel(wxDC &dc, wxRect rc, const Tick &tick, wxCoord coord)
+{
+    const wxSize &labelExtent = tick.extent;
 
     wxCoord x, y;
     wxCoord textX, textY;
     wxCoord lineX1, lineY1;
     wxCoord lineX2, lineY2;
-    int labelLineSize = isMajorLabel ? m_labelLineSize : m_labelLineSize / 2;
+    int labelLineSize = tick.isMajor ? m_labelLineSize : m_labelLineSize / 2;
 
     if (IsVertical()) {
-        y = ToGraphics(dc, rc.y, rc.height, value);
+        y = coord;
 
         lineY1 = lineY2 = y;
 
@@ -206,7 +314,7 @@ void LabelAxis::DrawLabel(wxDC &dc, wxRect rc, const wxString &label, double val
         }
     }
     else {
-        x = ToGraphics(dc, rc.x, rc.width, value);
+        x = coord;
 
         lineX1 = lineX2 = x;
 
@@ -249,13 +357,13 @@ void LabelAxis::DrawLabel(wxDC &dc, wxRect rc, const wxString &label, double val
     dc.DrawLine(lineX1, lineY1, lineX2, lineY2);
 
     // But only draw labels for major tick intervals.
-    if (isMajorLabel) 
+    if (tick.isMajor) 
     {
         if (m_verticalLabelText)
-            dc.DrawRotatedText(label, textX, textY, 90);
+            dc.DrawRotatedText(tick.label, textX, textY, 90);
         
         else
-            dc.DrawText(label, textX, textY);
+            dc.DrawText(tick.label, textX, textY);
     }
 }
 
@@ -298,40 +406,33 @@ void LabelAxis::DrawGridLines(wxDC &dc, wxRect rc)
     if (!HasLabels()) 
         return ;
 
-    for (int majorStep = 0; !IsEnd(majorStep); majorStep++) 
-    {
-        double value = GetValue(majorStep);
-        
-        if (!IsVisible(value))
-            continue;
+    UpdateTicks();
+
+    if (IsVertical()) {
+        UpdateTickCoords(m_gridCoords, rc.y, rc.height - 1);
+    }
+    else {
+        UpdateTickCoords(m_gridCoords, rc.x, rc.width - 1);
+    }
 
-        // Draw the major interval gridline.
-        dc.SetPen(m_majorGridlinePen);
-        DrawGridLine(dc, rc, value);
-
-        for (size_t minorStep = 1; minorStep <= m_minorIntervalCount; minorStep++)
-        {
-            // Calculate the value range between this label and the next (changes for non-linear axis, such as log).
-            double minorInterval = (GetValue(majorStep + 1) - GetValue(majorStep)) / m_minorIntervalCount;
-            
-            double minorValue = GetValue(majorStep) + (minorInterval * minorStep);
-
-            if (!IsVisible(minorValue))
-                continue;
-            
-            // Draw the minor interval gridline.
+    for (size_t n = 0; n < m_gridCoords.ticks.size(); n++) 
+    {
+        // Draw the major or minor interval gridline.
+        if (m_ticks[m_gridCoords.ticks[n]].isMajor)
+            dc.SetPen(m_majorGridlinePen);
+        else
             dc.SetPen(m_minorGridlinePen);
-            DrawGridLine(dc, rc, minorValue);
-        }
+
+        DrawGridLine(dc, rc, m_gridCoords.coords[n]);
     }
 }
 
-void LabelAxis::DrawGridLine(wxDC& dc, const wxRect& rc, double value)
+void LabelAxis::DrawGridLine(wxDC& dc, const wxRect& rc, wxCoord coord)
 {
     if (IsVertical()) 
     {
         // Vertical axis, so gridlines are horizontal.
-        wxCoord y = ToGraphics(dc, rc.y, rc.height - 1, value);
+        wxCoord y = coord;
 
         if (y == rc.y || y == (rc.y + rc.height - 1))
             return;
@@ -342,7 +443,7 @@ void LabelAxis::DrawGridLine(wxDC& dc, const wxRect& rc, double value)
     else 
     {
         // Horizontal axis, so gridlines are vertical.
-        wxCoord x = ToGraphics(dc, rc.x, rc.width - 1, value);
+        wxCoord x = coord;
 
         if (x == rc.x || x == (rc.x + rc.width - 1))
             return;
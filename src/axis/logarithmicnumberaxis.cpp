@@ -20,6 +20,10 @@ LogarithmicNumberAxis::LogarithmicNumberAxis(AXIS_LOCATION location)
 {
     m_logBase == 10.0 ? SetTickFormat(wxT("%2.2e")) : SetTickFormat(wxT("%2.2f"));
     SetMinorIntervalCount(9); 
+
+    m_logBaseLn = log(m_logBase);
+    m_cachedMin = m_cachedMax = 0;
+    m_cachedLogMin = m_cachedLogMax = 0;
 }
 
 LogarithmicNumberAxis::~LogarithmicNumberAxis()
@@ -31,6 +35,11 @@ bool LogarithmicNumberAxis::UpdateBounds()
     if (m_fixedBounds) 
         return false; // bounds are fixed, so don't update
 
+    double oldMinValue = m_minValue;
+    double oldMaxValue = m_maxValue;
+    size_t oldLabelCount = m_labelCount;
+    bool oldHasLabels = m_hasLabels;
+
     m_hasLabels = false;
 
     for (size_t n = 0; n < m_datasets.Count(); n++) 
@@ -58,11 +67,19 @@ bool LogarithmicNumberAxis::UpdateBounds()
     }
 
     // Note: log_base(n) = log(n) / log(base).
+    double logMin = floor(log(m_minValue) / m_logBaseLn);
+    double logMax = ceil(log(m_maxValue) / m_logBaseLn);
 
-    m_minValue = pow(m_logBase, floor(log(m_minValue) / log(m_logBase)));
-    m_maxValue = pow(m_logBase, ceil(log(m_maxValue) / log(m_logBase)));
+    m_minValue = pow(m_logBase, logMin);
+    m_maxValue = pow(m_logBase, logMax);
 
-    m_labelCount = (log(m_maxValue) / log(m_logBase)) - (log(m_minValue) / log(m_logBase)) + 1;
+    m_labelCount = (size_t) (logMax - logMin + 1);
+
+    // unchanged bounds are not reported, like in NumberAxis
+    if (m_minValue == oldMinValue && m_maxValue == oldMaxValue && m_labelCount == oldLabelCount) {
+        m_hasLabels = oldHasLabels;
+        return false;
+    }
 
     UpdateMajorIntervalValues();
     FireBoundsChanged();
@@ -71,83 +88,107 @@ bool LogarithmicNumberAxis::UpdateBounds()
 
 double LogarithmicNumberAxis::GetMinValue(Dataset* dataset)
 {
-  XYDataset* xyds = wxDynamicCast(dataset, XYDataset);
-  double min = 0;
-  if(IsVertical()) {
-    for (size_t serie = 0; serie < xyds->GetSerieCount(); serie++) {
-      for (size_t n = 0; n < xyds->GetCount(serie); n++) {
-        double y = xyds->GetY(n, serie);
+    // cached dataset bounds are enough, when all values can be shown on log scale
+    double minValue = dataset->GetMinValue(IsVertical());
+    if (minValue > 0) {
+        return minValue;
+    }
 
-        if(y == 0) continue;
+    for (size_t n = 0; n < m_datasets.Count(); n++) {
+        if (m_datasets[n] == dataset) {
+            return GetPositiveMin(n);
+        }
+    }
+    return 0;
+}
 
-        if (n == 0 && serie == 0)
-          min = y;
-        else
-          min = wxMin(min, y);
-      }
+double LogarithmicNumberAxis::GetPositiveMin(size_t index)
+{
+    Dataset *dataset = m_datasets[index];
+    XYDataset *xyds = wxDynamicCast(dataset, XYDataset);
+    if (xyds == NULL) {
+        return 0;
     }
-  }
-  else {
-    for (size_t serie = 0; serie < xyds->GetSerieCount(); serie++) {
-      for (size_t n = 0; n < xyds->GetCount(serie); n++) {
-        double x = xyds->GetX(n, serie);
 
-        if(x == 0) continue;
+    // datasets are never removed from axis, so cache entries
+    // are only added, and entry of dataset is at same index
+    while (m_positiveMins.size() < m_datasets.Count()) {
+        PositiveMin positiveMin;
+        positiveMin.dataset = NULL;
+        positiveMin.version = 0;
+        positiveMin.value = 0;
+        m_positiveMins.push_back(positiveMin);
+    }
 
-        if (n == 0 && serie == 0)
-          min = x;
-        else
-          min = wxMin(min, x);
-      }
+    PositiveMin &positiveMin = m_positiveMins[index];
+    bool valid = positiveMin.dataset == dataset && positiveMin.counts.size() == xyds->GetSerieCount();
+
+    if (valid && positiveMin.version == xyds->GetVersion()) {
+        return positiveMin.value;
     }
-  }
 
-  return min;
-}
+    // only appended values are scanned, if existing values are same
+    if (valid && xyds->GetModifyVersion() <= positiveMin.version) {
+        for (size_t serie = 0; serie < positiveMin.counts.size(); serie++) {
+            if (positiveMin.counts[serie] > xyds->GetCount(serie)) {
+                valid = false;
+            }
+        }
+    }
+    else {
+        valid = false;
+    }
 
-double LogarithmicNumberAxis::GetMaxValue(Dataset* dataset)
-{
-  XYDataset* xyds = wxDynamicCast(dataset, XYDataset);
-  double max = 0;
+    if (!valid) {
+        positiveMin.dataset = dataset;
+        positiveMin.counts.assign(xyds->GetSerieCount(), 0);
+        positiveMin.value = 0;
+    }
 
-  if(IsVertical()) {
-    for (size_t serie = 0; serie < xyds->GetSerieCount(); serie++) {
-      for (size_t n = 0; n < xyds->GetCount(serie); n++) {
-        double y = xyds->GetY(n, serie);
+    // search minimal positive value, not positive values are not shown
+    bool vertical = IsVertical();
+    double min = positiveMin.value;
+    bool found = min > 0;
+    XYDataBlock block;
 
-        if(y == 0) continue;
+    for (size_t serie = 0; serie < positiveMin.counts.size(); serie++) {
+        size_t first = positiveMin.counts[serie];
+        size_t count = xyds->GetCount(serie);
 
-        if (n == 0 && serie == 0)
-          max = y;
-        else
-          max = wxMax(max, y);
-      }
-    }
-  }
-  else {
-    for (size_t serie = 0; serie < xyds->GetSerieCount(); serie++) {
-      for (size_t n = 0; n < xyds->GetCount(serie); n++) {
-        double x = xyds->GetX(n, serie);
-        if (n == 0 && serie == 0)
-          max = x;
-        else
-          max = wxMax(max, x);
-      }
+        block.Load(xyds, serie, first, count - first);
+        const double *values = vertical ? block.GetY() : block.GetX();
+
+        for (size_t n = 0; n < block.GetCount(); n++) {
+            if (values[n] > 0 && (!found || values[n] < min)) {
+                min = values[n];
+                found = true;
+            }
+        }
+        positiveMin.counts[serie] = count;
     }
-  }
 
-  return max;
+    positiveMin.version = xyds->GetVersion();
+    positiveMin.value = min;
+    return min;
+}
+
+double LogarithmicNumberAxis::GetMaxValue(Dataset* dataset)
+{
+    return dataset->GetMaxValue(IsVertical());
 }
 
 void LogarithmicNumberAxis::SetLogBase(double logBase)
 {
     m_logBase = logBase;
+    m_logBaseLn = log(m_logBase);
+    m_cachedMin = m_cachedMax = 0; // drop cached logarithms
     m_logBase == 10.0 ? SetTickFormat(wxT("%2.2e")) : SetTickFormat(wxT("%2.2f"));
 }
 
 void LogarithmicNumberAxis::EnableLongLabelExponent(bool enable)
 {
     m_longExponent = enable;
+    InvalidateTicks();
 }
 
 double LogarithmicNumberAxis::GetValue(size_t step)
@@ -155,8 +196,8 @@ double LogarithmicNumberAxis::GetValue(size_t step)
     double min, max;
     GetDataBounds(min, max);
 
-    double logMin = log(min) / log(m_logBase);
-    double logMax = log(max) / log(m_logBase);
+    double logMin, logMax;
+    GetLogBounds(min, max, logMin, logMax);
 
     double logInterval = (logMax - logMin) / (GetLabelCount() - 1);
     return min * pow(m_logBase, step * logInterval);
@@ -175,6 +216,11 @@ void LogarithmicNumberAxis::GetLabel(size_t step, wxString& label)
 }
 
 wxCoord LogarithmicNumberAxis::ToGraphics(wxDC &WXUNUSED(dc), int minCoord, int gRange, double value)
+{
+    return GetTransform(minCoord, gRange).ToGraphics(value);
+}
+
+AxisTransform LogarithmicNumberAxis::GetTransform(int minCoord, int gRange)
 {
     double minValue, maxValue;
     GetDataBounds(minValue, maxValue);
@@ -191,32 +237,25 @@ wxCoord LogarithmicNumberAxis::ToGraphics(wxDC &WXUNUSED(dc), int minCoord, int
         maxValue = m_winPos + m_winWidth;
     }
 
-    double logValue = log(value) / log(m_logBase);
-    double logMax = log(maxValue) / log(m_logBase);
-    double logMin = log(minValue) / log(m_logBase);
-
-    return ::ToGraphics(minCoord, gRange, logMin, logMax, 0/*textMargin*/, IsVertical(), logValue);
+    return AxisTransform::Log(minCoord, gRange, minValue, maxValue, IsVertical());
 }
 
 double LogarithmicNumberAxis::ToData(wxDC &WXUNUSED(dc), int minCoord, int gRange, wxCoord g)
 {
-    double minValue, maxValue;
-    GetDataBounds(minValue, maxValue);
-
-    minCoord += m_marginMin;
-    gRange -= (m_marginMin + m_marginMax);
-    if (gRange < 0) {
-        gRange = 0;
-    }
+    return GetTransform(minCoord, gRange).ToData(g);
+}
 
-    if (m_useWin) {
-        minValue = m_winPos;
-        maxValue = m_winPos + m_winWidth;
+void LogarithmicNumberAxis::GetLogBounds(double minValue, double maxValue, double &logMin, double &logMax)
+{
+    if (minValue != m_cachedMin || maxValue != m_cachedMax) {
+        m_cachedMin = minValue;
+        m_cachedMax = maxValue;
+        m_cachedLogMin = log(minValue) / m_logBaseLn;
+        m_cachedLogMax = log(maxValue) / m_logBaseLn;
     }
 
-    double logMin = log(minValue) / log(m_logBase);
-    double logMax = log(minValue) / log(m_logBase);
-    return ::ToData(minCoord, gRange, logMin, logMax, 0/*textMargin*/, IsVertical(), g);
+    logMin = m_cachedLogMin;
+    logMax = m_cachedLogMax;
 }
 
 double LogarithmicNumberAxis::BoundValue(double value)
@@ -64,6 +64,7 @@ NumberAxis::NumberAxis(AXIS_LOCATION location)
     m_extraMajorInterval = false;
 
     m_multiplier = 1;
+    m_windowAxis = NULL;
 }
 
 NumberAxis::~NumberAxis()
@@ -76,6 +77,14 @@ bool NumberAxis::AcceptDataset(Dataset *WXUNUSED(dataset))
     return true;
 }
 
+void NumberAxis::SetFitToWindow(Axis *windowAxis)
+{
+    if (m_windowAxis != windowAxis) {
+        m_windowAxis = windowAxis;
+        UpdateBounds();
+    }
+}
+
 void NumberAxis::SetFixedBounds(double minValue, double maxValue)
 {
     m_minValue = minValue;
@@ -97,8 +106,21 @@ bool NumberAxis::UpdateBounds()
         return false;
     }
 
+    // bounds are reported only when they are changed, because
+    // every report redraws static part of the plot
+    double oldMinValue = m_minValue;
+    double oldMaxValue = m_maxValue;
+    double oldLabelInterval = m_labelInterval;
+    bool oldHasLabels = m_hasLabels;
+
     m_hasLabels = false;
 
+    double winMin = 0, winMax = 0;
+    if (m_windowAxis != NULL)
+        m_windowAxis->GetVisibleBounds(winMin, winMax);
+
+    bool hasValues = false;
+
     for (size_t n = 0; n < m_datasets.Count(); n++) 
     {
         size_t count = 0;
@@ -111,11 +133,27 @@ bool NumberAxis::UpdateBounds()
 
         bool verticalAxis = IsVertical();
 
-        double minValue = m_datasets[n]->GetMinValue(verticalAxis);
-        double maxValue = m_datasets[n]->GetMaxValue(verticalAxis);
+        double minValue;
+        double maxValue;
 
-        if (n == 0) 
+        // Fit to y values visible in window of other axis. Category datasets
+        // have their own value bounds (eg. stacked bars), so they are not fitted.
+        XYDataset *xyDataset = wxDynamicCast(m_datasets[n], XYDataset);
+        if (m_windowAxis != NULL && verticalAxis && xyDataset != NULL
+                && wxDynamicCast(m_datasets[n], CategoryDataset) == NULL)
         {
+            if (!xyDataset->GetYRangeForX(winMin, winMax, minValue, maxValue))
+                continue;
+        }
+        else
+        {
+            minValue = m_datasets[n]->GetMinValue(verticalAxis);
+            maxValue = m_datasets[n]->GetMaxValue(verticalAxis);
+        }
+
+        if (!hasValues) 
+        {
+            hasValues = true;
             m_minValue = minValue;
             m_maxValue = maxValue;
         }
@@ -151,7 +189,12 @@ bool NumberAxis::UpdateBounds()
     
     // The following might be a way of formatting the number of relevant decimal places.
     // int nfrac = wxMax(-floor(log10(nice)), 0);
-        
+
+    if (m_minValue == oldMinValue && m_maxValue == oldMaxValue && m_labelInterval == oldLabelInterval) {
+        m_hasLabels = oldHasLabels;
+        return false;
+    }
+
     UpdateMajorIntervalValues();
     FireBoundsChanged();
     return true;
@@ -279,4 +322,5 @@ double NumberAxis::GetMultiplier() const
 void NumberAxis::SetMultiplier(double multiplier)
 {
   m_multiplier = multiplier;
+  InvalidateTicks();
 }
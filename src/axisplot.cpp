@@ -9,13 +9,26 @@
 
 #include <wx/axisplot.h>
 #include <wx/drawutils.h>
+#include <wx/axis/numberaxis.h>
 
 #include "wx/arrimpl.cpp"
 
 #if wxUSE_GRAPHICS_CONTEXT
 #include <wx/dcgraph.h>
+#include <wx/graphics.h>
+#include <wx/image.h>
 #endif /* wxUSE_GRAPHICS_CONTEXT */
 
+#include <math.h>
+#include <string.h>
+
+// pixels before newest point of previous frame, redrawn in strip chart mode,
+// so line segments and symbols joining old and new data are complete
+#define STRIP_CHART_OVERLAP 8
+
+// maximal difference of horizontal axes scroll distances
+#define STRIP_CHART_SHIFT_EPSILON 1e-6
+
 
 #include <iostream>
 
@@ -30,6 +43,38 @@ WX_DEFINE_EXPORTED_OBJARRAY(DataAxisLinkArray)
 } while (0)
 
 
+/**
+ * Appends data and visible bounds of axis to bounds array.
+ */
+static void AppendAxisBounds(Axis *axis, wxVector<double> &bounds)
+{
+    double minValue, maxValue;
+
+    axis->GetDataBounds(minValue, maxValue);
+    bounds.push_back(minValue);
+    bounds.push_back(maxValue);
+
+    axis->GetVisibleBounds(minValue, maxValue);
+    bounds.push_back(minValue);
+    bounds.push_back(maxValue);
+}
+
+/**
+ * Checks whether bounds arrays are equal.
+ */
+static bool SameBounds(const wxVector<double> &bounds1, const wxVector<double> &bounds2)
+{
+    if (bounds1.size() != bounds2.size()) {
+        return false;
+    }
+    for (size_t n = 0; n < bounds1.size(); n++) {
+        if (bounds1[n] != bounds2[n]) {
+            return false;
+        }
+    }
+    return true;
+}
+
 AxisPlot::AxisPlot()
 {
     m_legendPlotGap = 2;
@@ -40,6 +85,21 @@ AxisPlot::AxisPlot()
     m_legend = NULL;
     m_crosshair = NULL;
     m_dataBackground = NULL;
+
+    m_redrawDataArea = true;
+    m_deferredUpdate = false;
+    m_updatePending = false;
+    m_applyingPending = false;
+    m_layoutValid = false;
+    m_updatingAxes = false;
+    m_datasetLayers = false;
+    m_layersAntialias = false;
+    m_stripChart = false;
+    m_stripValid = false;
+    m_stripAntialias = false;
+    m_stripBackground = NULL;
+    m_stripShift = 0;
+    m_softwareRaster = false;
     
     SetBackground(new FillAreaDraw(wxPen(DEFAULT_AXIS_BORDER_COLOUR)));
 }
@@ -104,6 +164,8 @@ void AxisPlot::AddAxis(Axis *axis)
     }
 
     axis->AddObserver(this);
+    InvalidateLayout();
+    m_stripValid = false;
 }
 
 bool AxisPlot::HasData()
@@ -113,7 +175,7 @@ bool AxisPlot::HasData()
 
 void AxisPlot::ChartPanelChanged(wxChartPanel *oldPanel, wxChartPanel *newPanel)
 {
-    m_redrawDataArea = true;
+    InvalidateBackground();
     FirePlotNeedRedraw();
 
     /* TODO
@@ -133,6 +195,8 @@ void AxisPlot::AddDataset(Dataset *dataset)
     m_datasets.Add(dataset);
     dataset->AddObserver(this);
     //dataset->AddRef();
+    InvalidateLayout();
+    m_stripValid = false;
     FirePlotNeedRedraw();
 }
 
@@ -162,9 +226,11 @@ void AxisPlot::LinkDataHorizontalAxis(size_t nData, size_t nAxis)
     CHECK_INDEX(wxT("horizontal axis"), nAxis, m_horizontalAxes);
 
     m_links.Add(new DataAxisLink(m_datasets[nData], m_horizontalAxes[nAxis]));
+    m_stripValid = false;
     m_horizontalAxes[nAxis]->AddDataset(m_datasets[nData]);
 
     m_horizontalAxes[nAxis]->UpdateBounds();
+    DataAxisLinked(m_datasets[nData], m_horizontalAxes[nAxis]);
 }
 
 void AxisPlot::LinkDataVerticalAxis(size_t nData, size_t nAxis)
@@ -173,14 +239,21 @@ void AxisPlot::LinkDataVerticalAxis(size_t nData, size_t nAxis)
     CHECK_INDEX(wxT("vertical axis"), nAxis, m_verticalAxes);
 
     m_links.Add(new DataAxisLink(m_datasets[nData], m_verticalAxes[nAxis]));
+    m_stripValid = false;
     m_verticalAxes[nAxis]->AddDataset(m_datasets[nData]);
 
     m_verticalAxes[nAxis]->UpdateBounds();
+    DataAxisLinked(m_datasets[nData], m_verticalAxes[nAxis]);
+}
+
+void AxisPlot::DataAxisLinked(Dataset *WXUNUSED(dataset), Axis *WXUNUSED(axis))
+{
 }
 
 void AxisPlot::SetLegend(Legend *legend)
 {
     wxREPLACE(m_legend, legend);
+    InvalidateLayout();
     FirePlotNeedRedraw();
 }
 
@@ -196,6 +269,8 @@ void AxisPlot::SetCrosshair(Crosshair *crosshair)
         GetChartPanel()->AddObserver(m_crosshair);
     }
     */
+    InvalidateBackground();
+    m_stripValid = false;
     FirePlotNeedRedraw();
 }
 
@@ -205,6 +280,10 @@ void AxisPlot::SetCrosshair(Crosshair *crosshair)
 bool AxisPlot::UpdateAxis(Dataset *dataset)
 {
     int updated = 0;
+
+    // layout is keyed on axes bounds, so bounds update does not invalidate it
+    bool updatingAxes = m_updatingAxes;
+    m_updatingAxes = true;
     
     for (size_t nLink = 0; nLink < m_links.Count(); nLink++) {
         DataAxisLink &link = m_links[nLink];
@@ -215,6 +294,8 @@ bool AxisPlot::UpdateAxis(Dataset *dataset)
             }
         }
     }
+
+    m_updatingAxes = updatingAxes;
     
     return updated > 0;
 }
@@ -224,6 +305,8 @@ void AxisPlot::SetDrawGrid(bool drawGridVertical, bool drawGridHorizontal)
     m_drawGridVertical = drawGridVertical;
     m_drawGridHorizontal = drawGridHorizontal;
 
+    InvalidateBackground();
+    m_stripValid = false;
     FirePlotNeedRedraw();
 }
 
@@ -268,28 +351,250 @@ Axis *AxisPlot::GetDatasetAxis(Dataset *dataset, bool vertical)
 
 void AxisPlot::NeedRedraw(DrawObject *WXUNUSED(obj))
 {
+    InvalidateBackground();
+    m_stripValid = false;
     FirePlotNeedRedraw();
 }
 
+void AxisPlot::SetDeferredUpdate(bool deferredUpdate)
+{
+    if (m_deferredUpdate != deferredUpdate) {
+        m_deferredUpdate = deferredUpdate;
+
+        if (!m_deferredUpdate) {
+            UpdatePending();
+        }
+    }
+}
+
+void AxisPlot::SetDatasetLayers(bool datasetLayers)
+{
+#if !wxUSE_GRAPHICS_CONTEXT
+    if (datasetLayers) {
+        // transparent layer bitmaps are drawn with graphics context
+        wxLogDebug(wxT("AxisPlot::SetDatasetLayers: dataset layers need wxUSE_GRAPHICS_CONTEXT, option stays off"));
+        datasetLayers = false;
+    }
+#endif
+
+    if (m_datasetLayers != datasetLayers) {
+        m_datasetLayers = datasetLayers;
+
+        // layers are freed, when turned off
+        m_layers.clear();
+        FirePlotNeedRedraw();
+    }
+}
+
+void AxisPlot::SetStripChart(bool stripChart)
+{
+    if (m_stripChart != stripChart) {
+        m_stripChart = stripChart;
+        m_stripValid = false;
+
+        if (!m_stripChart) {
+            m_stripBitmap = wxNullBitmap;
+            m_stripBackBitmap = wxNullBitmap;
+            m_stripDatasets.clear();
+            m_stripWindows.clear();
+        }
+        FirePlotNeedRedraw();
+    }
+}
+
+void AxisPlot::SetSoftwareRaster(bool softwareRaster)
+{
+    if (m_softwareRaster != softwareRaster) {
+        m_softwareRaster = softwareRaster;
+        m_stripValid = false;
+        FirePlotNeedRedraw();
+    }
+}
+
+void AxisPlot::SetUpdatePending()
+{
+    // only first change after draw requests redraw
+    if (!m_updatePending) {
+        m_updatePending = true;
+        FirePlotNeedRedraw();
+    }
+}
+
+void AxisPlot::UpdatePending()
+{
+    if (!m_updatePending) {
+        return ;
+    }
+
+    m_updatePending = false;
+
+    // axes bounds change notifications are not forwarded here,
+    // because plot is being redrawn anyway
+    m_applyingPending = true;
+
+    bool updated = false;
+    for (size_t n = 0; n < m_pendingDatasets.size(); n++) {
+        if (UpdateAxis(m_pendingDatasets[n])) {
+            updated = true;
+        }
+    }
+    for (size_t n = 0; n < m_pendingWindowAxes.size(); n++) {
+        UpdateWindowAxes(m_pendingWindowAxes[n]);
+        updated = true;
+    }
+
+    m_applyingPending = false;
+
+    m_pendingDatasets.clear();
+    m_pendingWindowAxes.clear();
+
+    if (updated) {
+        InvalidateBackground();
+    }
+}
+
 void AxisPlot::DatasetChanged(Dataset *dataset)
 {
+    InvalidateDatasetLayer(dataset);
+    StripDatasetChanged(dataset);
+
+    if (m_deferredUpdate) {
+        size_t n;
+        for (n = 0; n < m_pendingDatasets.size(); n++) {
+            if (m_pendingDatasets[n] == dataset) {
+                break;
+            }
+        }
+        if (n == m_pendingDatasets.size()) {
+            m_pendingDatasets.push_back(dataset);
+        }
+
+        SetUpdatePending();
+        return ;
+    }
+
     // Update the axis. If the axis have changed (UpdateAxis returns true)
     // then redraw the chart background because the scale will have changed.
+    // Otherwise background is left as is, it can be still invalid from
+    // change, that was not drawn yet.
     if (UpdateAxis(dataset))
-        m_redrawDataArea = true;
-    else
-        m_redrawDataArea = false;
+        InvalidateBackground();
 
     FirePlotNeedRedraw();
 }
 
-void AxisPlot::AxisChanged(Axis *WXUNUSED(axis))
+void AxisPlot::DatasetChanged(Dataset *dataset, const DatasetChange &change)
 {
+    // legend shows serie names
+    if (change.GetKind() == DATASET_CHANGE_ALL || change.GetKind() == DATASET_CHANGE_RENAME) {
+        InvalidateLayout();
+    }
+
+    // strip chart can only scroll appended data, and
+    // oldest data removed from serie start (evicted)
+    switch (change.GetKind()) {
+    case DATASET_CHANGE_APPEND:
+    case DATASET_CHANGE_RENAME:
+        break;
+    case DATASET_CHANGE_REMOVE:
+        if (change.GetFirst() != 0) {
+            m_stripValid = false;
+        }
+        break;
+    default:
+        m_stripValid = false;
+        break;
+    }
+
+    if (change.IsValuesChanged()) {
+        if (dataset->HasNextChange()) {
+            // axes are updated and plot is redrawn on following change
+            InvalidateDatasetLayer(dataset);
+            StripDatasetChanged(dataset);
+            return ;
+        }
+
+        DatasetChanged(dataset);
+        return ;
+    }
+
+    // serie name or renderer is changed, axes are same,
+    // but legend must be redrawn
+    InvalidateBackground();
+    InvalidateDatasetLayer(dataset);
+
+    if (m_deferredUpdate) {
+        SetUpdatePending();
+    }
+    else {
+        FirePlotNeedRedraw();
+    }
+}
+
+void AxisPlot::AxisChanged(Axis *axis)
+{
+    // axis fonts, title or labels format can be changed,
+    // as well as margins or scale, that are not part of bounds
+    if (!m_updatingAxes) {
+        InvalidateLayout();
+        InvalidateDatasetLayer(NULL);
+        StripAxisChanged(axis);
+    }
+
+    if (m_applyingPending) {
+        return ;
+    }
+
+    if (m_deferredUpdate) {
+        size_t n;
+        for (n = 0; n < m_pendingWindowAxes.size(); n++) {
+            if (m_pendingWindowAxes[n] == axis) {
+                break;
+            }
+        }
+        if (n == m_pendingWindowAxes.size()) {
+            m_pendingWindowAxes.push_back(axis);
+        }
+
+        SetUpdatePending();
+        return ;
+    }
+
+    UpdateWindowAxes(axis);
     FirePlotNeedRedraw();
 }
 
+void AxisPlot::UpdateWindowAxes(Axis *axis)
+{
+    // update axes, that fit their bounds to window of changed axis
+    AxisArray *axesArrays[] = { &m_verticalAxes, &m_horizontalAxes };
+
+    bool updatingAxes = m_updatingAxes;
+    m_updatingAxes = true;
+
+    for (size_t nArray = 0; nArray < WXSIZEOF(axesArrays); nArray++) {
+        AxisArray &axes = *axesArrays[nArray];
+
+        for (size_t nAxis = 0; nAxis < axes.Count(); nAxis++) {
+            NumberAxis *numberAxis = wxDynamicCast(axes[nAxis], NumberAxis);
+
+            if (numberAxis != NULL && numberAxis->GetFitToWindow() == axis) {
+                numberAxis->UpdateBounds();
+            }
+        }
+    }
+
+    m_updatingAxes = updatingAxes;
+}
+
 void AxisPlot::BoundsChanged(Axis *WXUNUSED(axis))
 {
+    InvalidateBackground();
+
+    if (m_applyingPending) {
+        return ;
+    }
+
     FirePlotNeedRedraw();
 }
 
@@ -302,6 +607,18 @@ wxCoord AxisPlot::GetAxesExtent(wxDC &dc, AxisArray *axes)
     return ext;
 }
 
+wxCoord AxisPlot::CalcAxesExtents(wxDC &dc, AxisArray *axes)
+{
+    wxCoord ext = 0;
+    for (size_t nAxis = 0; nAxis < axes->Count(); nAxis++) {
+        wxCoord axisExt = (*axes)[nAxis]->GetExtent(dc);
+
+        m_layout.axesExtents.push_back(axisExt);
+        ext += axisExt;
+    }
+    return ext;
+}
+
 bool AxisPlot::ToDataCoords(size_t nData, wxDC &dc, wxRect rc, wxCoord gx, wxCoord gy, double *x, double *y)
 {
     Dataset *dataset = GetDataset(nData);
@@ -327,6 +644,50 @@ bool AxisPlot::ToDataCoords(size_t nData, wxDC &dc, wxRect rc, wxCoord gx, wxCoo
 
 void AxisPlot::CalcDataArea(wxDC &dc, wxRect rc, wxRect &rcData, wxRect &rcLegend)
 {
+    UpdateLayout(dc, rc);
+
+    rcData = m_layout.rcData;
+    rcLegend = m_layout.rcLegend;
+}
+
+void AxisPlot::UpdateLayout(wxDC &dc, wxRect rc)
+{
+    TextMeasureKey measureKey(dc);
+    wxFont legendFont = (m_legend != NULL) ? m_legend->GetTextFont() : wxNullFont;
+
+    // axes extents depend on labels, which depend on axes bounds
+    wxVector<double> axesBounds;
+    AxisArray *axesArrays[] = { &m_verticalAxes, &m_horizontalAxes };
+
+    for (size_t nArray = 0; nArray < WXSIZEOF(axesArrays); nArray++) {
+        AxisArray &axes = *axesArrays[nArray];
+
+        for (size_t nAxis = 0; nAxis < axes.Count(); nAxis++) {
+            AppendAxisBounds(axes[nAxis], axesBounds);
+        }
+    }
+
+    if (m_layoutValid && SameBounds(axesBounds, m_layout.axesBounds) && rc == m_layout.rc
+            && measureKey == m_layout.measureKey && legendFont == m_layout.legendFont) {
+        return ;
+    }
+
+    m_layout.rc = rc;
+    m_layout.measureKey = measureKey;
+    m_layout.legendFont = legendFont;
+    m_layout.axesBounds = axesBounds;
+    m_layoutValid = true;
+
+    CalcLayout(dc, rc);
+}
+
+void AxisPlot::CalcLayout(wxDC &dc, wxRect rc)
+{
+    wxRect &rcData = m_layout.rcData;
+    wxRect &rcLegend = m_layout.rcLegend;
+
+    m_layout.axesExtents.clear();
+
     if (m_legend != NULL) {
         wxSize legendExtent = m_legend->GetExtent(dc, m_datasets);
 
@@ -380,24 +741,24 @@ void AxisPlot::CalcDataArea(wxDC &dc, wxRect rc, wxRect &rcData, wxRect &rcLegen
 
     // substract axes areas from data rectangle
     if (m_leftAxes.Count() != 0) {
-        wxCoord ext = GetAxesExtent(dc, &m_leftAxes);
+        wxCoord ext = CalcAxesExtents(dc, &m_leftAxes);
 
         rcData.x += ext;
         rcData.width -= ext;
     }
     if (m_rightAxes.Count() != 0) {
-        wxCoord ext = GetAxesExtent(dc, &m_rightAxes);
+        wxCoord ext = CalcAxesExtents(dc, &m_rightAxes);
 
         rcData.width -= ext;
     }
     if (m_topAxes.Count() != 0) {
-        wxCoord ext = GetAxesExtent(dc, &m_topAxes);
+        wxCoord ext = CalcAxesExtents(dc, &m_topAxes);
 
         rcData.y += ext;
         rcData.height -= ext;
     }
     if (m_bottomAxes.Count() != 0) {
-        wxCoord ext = GetAxesExtent(dc, &m_bottomAxes);
+        wxCoord ext = CalcAxesExtents(dc, &m_bottomAxes);
 
         rcData.height -= ext;
     }
@@ -405,13 +766,13 @@ void AxisPlot::CalcDataArea(wxDC &dc, wxRect rc, wxRect &rcData, wxRect &rcLegen
     CheckFixRect(rcData);
 }
 
-void AxisPlot::DrawAxesArray(wxDC &dc, wxRect rc, AxisArray *axes, bool vertical)
+void AxisPlot::DrawAxesArray(wxDC &dc, wxRect rc, AxisArray *axes, const wxCoord *extents, bool vertical)
 {
     wxRect rcAxis(rc);
 
     for (size_t nAxis = 0; nAxis < axes->Count(); nAxis++) {
         Axis *axis = (*axes)[nAxis];
-        wxCoord ext = axis->GetExtent(dc);
+        wxCoord ext = extents[nAxis];
 
         if (vertical) {
             rcAxis.width = ext;
@@ -433,22 +794,32 @@ void AxisPlot::DrawAxesArray(wxDC &dc, wxRect rc, AxisArray *axes, bool vertical
 
 void AxisPlot::DrawAxes(wxDC &dc, wxRect &rc, wxRect rcData)
 {
+    // extents are calculated by layout in order of left, right, top and bottom axes
+    const wxCoord *extents = m_layout.axesExtents.size() ? &m_layout.axesExtents[0] : NULL;
+    const wxCoord *rightExtents = extents + m_leftAxes.Count();
+    const wxCoord *topExtents = rightExtents + m_rightAxes.Count();
+    const wxCoord *bottomExtents = topExtents + m_topAxes.Count();
+
+    if (m_layout.axesExtents.size() != m_verticalAxes.Count() + m_horizontalAxes.Count()) {
+        return ; // layout is not calculated
+    }
+
     if (m_leftAxes.Count() != 0) {
         wxRect rcLeftAxes(rc.x, rcData.y, (rcData.x - rc.x), rcData.height - 1);
-        DrawAxesArray(dc, rcLeftAxes, &m_leftAxes, true);
+        DrawAxesArray(dc, rcLeftAxes, &m_leftAxes, extents, true);
     }
     if (m_rightAxes.Count() != 0) {
         wxRect rcRightAxes(rcData.x + rcData.width - 1, rcData.y, (rc.x + rc.width - rcData.x - rcData.width - 1), rcData.height);
-        DrawAxesArray(dc, rcRightAxes, &m_rightAxes, true);
+        DrawAxesArray(dc, rcRightAxes, &m_rightAxes, rightExtents, true);
     }
     if (m_topAxes.Count() != 0) {
         wxRect rcTopAxes(rcData.x, rc.y, rcData.width, (rcData.y - rc.y));
         //wxRect rcTopAxes(rcData.x, rc.y + 2, rcData.width, (rcData.y - rc.y + 2));
-        DrawAxesArray(dc, rcTopAxes, &m_topAxes, false);
+        DrawAxesArray(dc, rcTopAxes, &m_topAxes, topExtents, false);
     }
     if (m_bottomAxes.Count() != 0) {
         wxRect rcBottomAxes(rcData.x, rcData.y + rcData.height - 1, rcData.width, (rc.y + rc.height - rcData.y - rcData.height - 1));
-        DrawAxesArray(dc, rcBottomAxes, &m_bottomAxes, false);
+        DrawAxesArray(dc, rcBottomAxes, &m_bottomAxes, bottomExtents, false);
     }
 }
 
@@ -487,6 +858,8 @@ void AxisPlot::DrawBackground(ChartDC& cdc, wxRect rc)
     
     wxDC& dc = cdc.GetDC();
 
+    UpdatePending();
+
     // Calculate the rectangle where the actual data is plotted.
     CalcDataArea(dc, rc, rcPlot, rcLegend);
 
@@ -506,6 +879,21 @@ void AxisPlot::DrawBackground(ChartDC& cdc, wxRect rc)
     }
 }
 
+bool AxisPlot::CheckBackgroundChanged()
+{
+    // pending axes update can change background
+    UpdatePending();
+
+    bool changed = m_redrawDataArea;
+    m_redrawDataArea = false;
+    return changed;
+}
+
+void AxisPlot::InvalidateBackground()
+{
+    m_redrawDataArea = true;
+}
+
 void AxisPlot::DrawData(ChartDC& cdc, wxRect rc)
 {
     wxRect rcPlot;
@@ -513,6 +901,8 @@ void AxisPlot::DrawData(ChartDC& cdc, wxRect rc)
     
     wxDC& dc = cdc.GetDC();
 
+    UpdatePending();
+
     // Calculate the rectangle where the actual data is plotted.
     CalcDataArea(dc, rc, rcPlot, rcLegend);
     
@@ -527,12 +917,33 @@ void AxisPlot::DrawData(ChartDC& cdc, wxRect rc)
     // a scrolled window is in use. The clipper is specific to the DC, so has to be created within
     // the correct context.
 #if wxUSE_GRAPHICS_CONTEXT
-		if (cdc.AntialiasActive()) 
+        if (wxDynamicCast(&dc, wxGCDC) != NULL)
+        {
+            // graphics context DC (headless rendering by Chart::RenderToImage)
+            // already has its antialias mode, and bitmap caches used by strip
+            // chart and dataset layers need GUI thread, so draw directly
+            wxDCClipper clip(dc, rcPlot);
+            DrawDatasets(dc, rcPlot);
+        }
+        else if (m_stripChart)
+        {
+            DrawStripChart(dc, rcPlot, cdc.AntialiasActive());
+        }
+        else if (m_datasetLayers)
+        {
+            // layers are clipped by their bitmaps size
+            DrawDatasetLayers(dc, rcPlot, cdc.AntialiasActive());
+        }
+		else if (cdc.AntialiasActive()) 
         {
 			wxGCDC gdc((wxMemoryDC&)dc);
             wxDCClipper clip(gdc, rcPlot);
 			DrawDatasets(gdc, rcPlot);
 		}
+		else if (m_softwareRaster && wxDynamicCast(&dc, wxMemoryDC) != NULL)
+        {
+            DrawDatasetsRaster((wxMemoryDC &) dc, rcPlot, rcPlot);
+        }
 		else
         {
             wxDCClipper clip(dc, rcPlot);
@@ -540,11 +951,381 @@ void AxisPlot::DrawData(ChartDC& cdc, wxRect rc)
         }
 			
 #else
-        wxDCClipper clip(dc, rcPlot);
-		DrawDatasets(dc, rcPlot);
+        if (m_stripChart)
+        {
+            DrawStripChart(dc, rcPlot, false);
+        }
+        else if (m_softwareRaster && wxDynamicCast(&dc, wxMemoryDC) != NULL)
+        {
+            DrawDatasetsRaster((wxMemoryDC &) dc, rcPlot, rcPlot);
+        }
+        else
+        {
+            wxDCClipper clip(dc, rcPlot);
+            DrawDatasets(dc, rcPlot);
+        }
 #endif
 }
 
+void AxisPlot::DrawDatasets(wxDC &dc, wxRect rc)
+{
+    for (size_t nData = 0; nData < m_datasets.Count(); nData++) {
+        DrawDataset(dc, rc, m_datasets[nData]);
+    }
+}
+
+void AxisPlot::DrawDataset(wxDC &WXUNUSED(dc), wxRect WXUNUSED(rc), Dataset *WXUNUSED(dataset))
+{
+    // default - do nothing
+}
+
+bool AxisPlot::CanRasterizeDataset(Dataset *WXUNUSED(dataset))
+{
+    return false;
+}
+
+void AxisPlot::RasterizeDataset(ChartRaster &WXUNUSED(raster), wxRect WXUNUSED(rc), Dataset *WXUNUSED(dataset))
+{
+    // default - do nothing
+}
+
+void AxisPlot::DrawDatasetsRaster(wxMemoryDC &mdc, wxRect rc, wxRect rcClip)
+{
+    size_t n = 0;
+
+    // datasets are drawn in their order, consecutive
+    // rasterizable ones share one pixel data access
+    while (n < m_datasets.Count()) {
+        if (CanRasterizeDataset(m_datasets[n])) {
+            size_t count = RasterizeDatasets(mdc, rc, rcClip, n);
+
+            if (count != 0) {
+                n += count;
+                continue;
+            }
+        }
+
+        wxDCClipper clip(mdc, rcClip);
+        DrawDataset(mdc, rc, m_datasets[n]);
+        n++;
+    }
+}
+
+size_t AxisPlot::RasterizeDatasets(wxMemoryDC &mdc, wxRect rc, wxRect rcClip, size_t first)
+{
+    wxBitmap bitmap = mdc.GetSelectedBitmap();
+    if (!bitmap.IsOk()) {
+        return 0;
+    }
+
+    wxCoord originX = mdc.LogicalToDeviceX(0);
+    wxCoord originY = mdc.LogicalToDeviceY(0);
+    size_t n = first;
+
+    // bitmap pixels must not be accessed, while it is selected into DC
+    mdc.SelectObject(wxNullBitmap);
+    {
+        wxNativePixelData data(bitmap);
+
+        if (data) {
+            ChartRaster raster(data);
+            raster.SetOffset(originX, originY);
+            raster.SetClippingRect(rcClip);
+
+            for (; n < m_datasets.Count() && CanRasterizeDataset(m_datasets[n]); n++) {
+                RasterizeDataset(raster, rc, m_datasets[n]);
+            }
+        }
+    }
+    mdc.SelectObject(bitmap);
+
+    return n - first;
+}
+
+void AxisPlot::DrawDatasetLayers(wxDC &dc, wxRect rc, bool antialias)
+{
+#if wxUSE_GRAPHICS_CONTEXT
+    if (rc.width <= 0 || rc.height <= 0) {
+        return ;
+    }
+
+    if (rc != m_layersRect || antialias != m_layersAntialias) {
+        m_layersRect = rc;
+        m_layersAntialias = antialias;
+        InvalidateDatasetLayer(NULL);
+    }
+
+    m_layers.resize(m_datasets.Count());
+
+    for (size_t nData = 0; nData < m_datasets.Count(); nData++) {
+        DatasetLayer &layer = m_layers[nData];
+        Dataset *dataset = m_datasets[nData];
+
+        if (layer.dataset != dataset) {
+            layer.dataset = dataset;
+            layer.valid = false;
+        }
+
+        // layer is redrawn, when any of dataset axes is moved
+        wxVector<double> axesBounds;
+        for (size_t nLink = 0; nLink < m_links.Count(); nLink++) {
+            if (m_links[nLink].m_dataset == dataset) {
+                AppendAxisBounds(m_links[nLink].m_axis, axesBounds);
+            }
+        }
+
+        if (!layer.valid || !SameBounds(axesBounds, layer.axesBounds)) {
+            DrawDatasetLayer(layer, rc, antialias);
+            layer.axesBounds = axesBounds;
+            layer.valid = true;
+        }
+
+        dc.DrawBitmap(layer.bitmap, rc.x, rc.y, true);
+    }
+#else
+    wxUnusedVar(antialias);
+    DrawDatasets(dc, rc);
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+}
+
+void AxisPlot::DrawDatasetLayer(DatasetLayer &layer, wxRect rc, bool antialias)
+{
+#if wxUSE_GRAPHICS_CONTEXT
+    // graphics context over image keeps alpha channel on all platforms,
+    // unlike drawing to bitmap with wxMemoryDC
+    wxImage image(rc.width, rc.height, true);
+    image.InitAlpha();
+    memset(image.GetAlpha(), wxIMAGE_ALPHA_TRANSPARENT, rc.width * rc.height);
+
+    {
+        wxGraphicsContext *context = wxGraphicsContext::Create(image);
+        context->SetAntialiasMode(antialias ? wxANTIALIAS_DEFAULT : wxANTIALIAS_NONE);
+
+        // image is updated, when graphics context is destroyed with gdc
+        wxGCDC gdc(context);
+        gdc.SetDeviceOrigin(-rc.x, -rc.y);
+        DrawDataset(gdc, rc, layer.dataset);
+    }
+
+    layer.bitmap = wxBitmap(image);
+#else
+    wxUnusedVar(layer);
+    wxUnusedVar(rc);
+    wxUnusedVar(antialias);
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+}
+
+void AxisPlot::DrawStripChart(wxDC &dc, wxRect rc, bool antialias)
+{
+    if (rc.width <= 0 || rc.height <= 0) {
+        return ;
+    }
+
+    wxVector<double> vertBounds;
+    for (size_t nAxis = 0; nAxis < m_verticalAxes.Count(); nAxis++) {
+        AppendAxisBounds(m_verticalAxes[nAxis], vertBounds);
+    }
+
+    // data area can be scrolled, only when everything
+    // except horizontal axes position is same
+    bool full = !m_stripValid || rc != m_stripRect || antialias != m_stripAntialias
+            || m_background != m_stripBackground
+            || !SameBounds(vertBounds, m_stripVertBounds)
+            || m_stripScales.size() != m_horizontalAxes.Count()
+            || m_stripDatasets.size() != m_datasets.Count();
+
+    wxVector<double> scales;
+    wxVector<double> offsets;
+    for (size_t nAxis = 0; nAxis < m_horizontalAxes.Count(); nAxis++) {
+        AxisTransform transform = m_horizontalAxes[nAxis]->GetTransform(rc.x, rc.width);
+
+        scales.push_back(transform.GetScale());
+        offsets.push_back(transform.GetOffset());
+
+        if (transform.HasValueMap() || (!full && scales[nAxis] != m_stripScales[nAxis])) {
+            full = true;
+        }
+    }
+
+    wxCoord shift = 0;
+    if (!full && offsets.size() != 0) {
+        // all horizontal axes must be scrolled by same distance
+        double delta = offsets[0] - m_stripOffsets[0];
+
+        for (size_t nAxis = 1; nAxis < offsets.size(); nAxis++) {
+            if (fabs(offsets[nAxis] - m_stripOffsets[nAxis] - delta) > STRIP_CHART_SHIFT_EPSILON) {
+                full = true;
+            }
+        }
+
+        // total distance since last full redraw is rounded, so
+        // error of scrolling by whole pixels does not accumulate
+        shift = (wxCoord) floor(delta + 0.5);
+    }
+
+    // only scrolling to newer data (to the left) is supported
+    wxCoord dx = shift - m_stripShift;
+    if (dx > 0 || -dx >= rc.width) {
+        full = true;
+    }
+
+    wxCoord dirtyX = rc.x;
+
+    if (full) {
+        wxSize size(rc.x + rc.width, rc.y + rc.height);
+
+        // bitmaps use plot coordinates, so no device origin is needed
+        if (!m_stripBitmap.IsOk() || m_stripBitmap.GetWidth() != size.x || m_stripBitmap.GetHeight() != size.y) {
+            m_stripBitmap.Create(size.x, size.y);
+            m_stripBackBitmap.Create(size.x, size.y);
+        }
+
+        m_stripRect = rc;
+        m_stripAntialias = antialias;
+        m_stripBackground = m_background;
+        m_stripScales = scales;
+        m_stripOffsets = offsets;
+        m_stripShift = 0;
+        m_stripDatasets.resize(m_datasets.Count());
+    }
+    else {
+        // exposed strip and newest data of changed datasets are drawn
+        dirtyX = rc.x + rc.width + dx;
+
+        for (size_t nData = 0; nData < m_stripDatasets.size(); nData++) {
+            StripDataset &stripDataset = m_stripDatasets[nData];
+            Axis *horizAxis = GetDatasetHorizontalAxis(stripDataset.dataset);
+
+            if (stripDataset.changed && horizAxis != NULL) {
+                AxisTransform transform = horizAxis->GetTransform(rc.x, rc.width);
+                dirtyX = wxMin(dirtyX, transform.ToGraphics(stripDataset.maxValue) - STRIP_CHART_OVERLAP);
+            }
+        }
+        dirtyX = wxMax(dirtyX, rc.x);
+
+        if (dx != 0 && dirtyX > rc.x) {
+            {
+                wxMemoryDC srcDC;
+                srcDC.SelectObjectAsSource(m_stripBitmap);
+                wxMemoryDC dstDC;
+                dstDC.SelectObject(m_stripBackBitmap);
+
+                dstDC.Blit(rc.x, rc.y, rc.width + dx, rc.height, &srcDC, rc.x - dx, rc.y);
+            }
+
+            wxBitmap bitmap = m_stripBitmap;
+            m_stripBitmap = m_stripBackBitmap;
+            m_stripBackBitmap = bitmap;
+        }
+        m_stripShift = shift;
+    }
+
+    if (dirtyX < rc.x + rc.width) {
+        DrawStrip(rc, wxRect(dirtyX, rc.y, rc.x + rc.width - dirtyX, rc.height), antialias);
+    }
+
+    m_stripVertBounds = vertBounds;
+    for (size_t nData = 0; nData < m_datasets.Count(); nData++) {
+        StripDataset &stripDataset = m_stripDatasets[nData];
+
+        stripDataset.dataset = m_datasets[nData];
+        stripDataset.maxValue = m_datasets[nData]->GetMaxValue(false);
+        stripDataset.changed = false;
+    }
+    m_stripValid = true;
+
+    wxMemoryDC mdc;
+    mdc.SelectObjectAsSource(m_stripBitmap);
+    dc.Blit(rc.x, rc.y, rc.width, rc.height, &mdc, rc.x, rc.y);
+}
+
+void AxisPlot::DrawStrip(wxRect rc, wxRect rcStrip, bool antialias)
+{
+    // rectangle passed to background drawing, data is drawn deflated by one
+    wxRect rcData = rc;
+    rcData.Inflate(1);
+
+    wxMemoryDC mdc;
+    mdc.SelectObject(m_stripBitmap);
+
+    wxDCClipper clip(mdc, rcStrip);
+
+    m_background->Draw(mdc, rcData);
+    DrawGridLines(mdc, rcData);
+    DrawMarkers(mdc, rcData);
+
+#if wxUSE_GRAPHICS_CONTEXT
+    if (antialias) {
+        wxGCDC gdc(mdc);
+        wxDCClipper gclip(gdc, rcStrip);
+        DrawDatasets(gdc, rc);
+        return ;
+    }
+#else
+    wxUnusedVar(antialias);
+#endif /* wxUSE_GRAPHICS_CONTEXT */
+
+    if (m_softwareRaster) {
+        DrawDatasetsRaster(mdc, rc, rcStrip);
+        return ;
+    }
+    DrawDatasets(mdc, rc);
+}
+
+void AxisPlot::StripDatasetChanged(Dataset *dataset)
+{
+    if (!m_stripChart) {
+        return ;
+    }
+
+    for (size_t n = 0; n < m_stripDatasets.size(); n++) {
+        if (m_stripDatasets[n].dataset == dataset) {
+            m_stripDatasets[n].changed = true;
+            return ;
+        }
+    }
+    m_stripValid = false;
+}
+
+void AxisPlot::StripAxisChanged(Axis *axis)
+{
+    if (!m_stripChart) {
+        return ;
+    }
+
+    for (size_t n = 0; n < m_stripWindows.size(); n++) {
+        StripWindow &stripWindow = m_stripWindows[n];
+
+        if (stripWindow.axis == axis) {
+            // same window means that axis style is changed
+            if (stripWindow.winPos == axis->GetWindowPosition()
+                    && stripWindow.winWidth == axis->GetWindowWidth()) {
+                m_stripValid = false;
+            }
+            stripWindow.winPos = axis->GetWindowPosition();
+            stripWindow.winWidth = axis->GetWindowWidth();
+            return ;
+        }
+    }
+
+    StripWindow stripWindow;
+    stripWindow.axis = axis;
+    stripWindow.winPos = axis->GetWindowPosition();
+    stripWindow.winWidth = axis->GetWindowWidth();
+    m_stripWindows.push_back(stripWindow);
+
+    m_stripValid = false;
+}
+
+void AxisPlot::InvalidateDatasetLayer(Dataset *dataset)
+{
+    for (size_t n = 0; n < m_layers.size(); n++) {
+        if (dataset == NULL || m_layers[n].dataset == dataset) {
+            m_layers[n].valid = false;
+        }
+    }
+}
+
 // TODO: Everything below this point is still TODO.
 
 /*
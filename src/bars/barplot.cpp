@@ -32,40 +32,55 @@ bool BarPlot::AcceptDataset(Dataset *dataset)
     return (wxDynamicCast(dataset, CategoryDataset) != NULL);
 }
 
-void BarPlot::DrawDatasets(wxDC &dc, wxRect rc)
+void BarPlot::DrawDataset(wxDC &dc, wxRect rc, Dataset *dataset)
 {
-    for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
-        CategoryDataset *dataset = (CategoryDataset *) GetDataset(nData);
-        BarRenderer *renderer = dataset->GetRenderer();
-        wxCHECK_RET(renderer != NULL, wxT("no renderer for data"));
+    CategoryDataset *categoryDataset = (CategoryDataset *) dataset;
+    BarRenderer *renderer = categoryDataset->GetRenderer();
+    wxCHECK_RET(renderer != NULL, wxT("no renderer for data"));
 
-        Axis *vertAxis = GetDatasetVerticalAxis(dataset);
-        Axis *horizAxis = GetDatasetHorizontalAxis(dataset);
+    Axis *vertAxis = GetDatasetVerticalAxis(dataset);
+    Axis *horizAxis = GetDatasetHorizontalAxis(dataset);
 
-        wxCHECK_RET(vertAxis != NULL, wxT("no axis for data"));
-        wxCHECK_RET(horizAxis != NULL, wxT("no axis for data"));
+    wxCHECK_RET(vertAxis != NULL, wxT("no axis for data"));
+    wxCHECK_RET(horizAxis != NULL, wxT("no axis for data"));
 
-        // Determine if this is a horizontal or a vertical bar plot.
-        // TODO: Should this be done here? Maybe when the axis are added.
-        bool verticalBars;
-        if (wxDynamicCast(horizAxis, CategoryAxis) != NULL ||
-                wxDynamicCast(horizAxis, DateAxis) != NULL) {
-            verticalBars = true;
-        }
-        else if (wxDynamicCast(vertAxis, CategoryAxis) != NULL ||
-                wxDynamicCast(vertAxis, DateAxis) != NULL) {
-            verticalBars = false;
-        }
-        else {
-            // wrong plot configuration, TODO be handled not here
-            return ;
-        }
-        
-        // Do not draw gridlines in the same direction as the bars.
-        // Would be better when the grid direction is determined so this can be overridden if desired.
-        m_drawGridHorizontal = !verticalBars;
-        m_drawGridVertical = verticalBars;
+    bool verticalBars;
+    if (!GetBarsDirection(horizAxis, vertAxis, verticalBars)) {
+        // wrong plot configuration, TODO be handled not here
+        return ;
+    }
+
+    renderer->Draw(dc, rc, horizAxis, vertAxis, verticalBars, categoryDataset);
+}
 
-        renderer->Draw(dc, rc, horizAxis, vertAxis, verticalBars, dataset);
+void BarPlot::DataAxisLinked(Dataset *dataset, Axis *WXUNUSED(axis))
+{
+    Axis *vertAxis = GetDatasetVerticalAxis(dataset);
+    Axis *horizAxis = GetDatasetHorizontalAxis(dataset);
+
+    // bars direction is known, when both axes are linked
+    bool verticalBars;
+    if (vertAxis == NULL || horizAxis == NULL || !GetBarsDirection(horizAxis, vertAxis, verticalBars)) {
+        return ;
+    }
+
+    // Do not draw gridlines in the same direction as the bars.
+    // This can be overridden with SetDrawGrid after axes are linked.
+    SetDrawGrid(verticalBars, !verticalBars);
+}
+
+bool BarPlot::GetBarsDirection(Axis *horizAxis, Axis *vertAxis, bool &verticalBars)
+{
+    // Determine if this is a horizontal or a vertical bar plot.
+    if (wxDynamicCast(horizAxis, CategoryAxis) != NULL ||
+            wxDynamicCast(horizAxis, DateAxis) != NULL) {
+        verticalBars = true;
+        return true;
+    }
+    else if (wxDynamicCast(vertAxis, CategoryAxis) != NULL ||
+            wxDynamicCast(vertAxis, DateAxis) != NULL) {
+        verticalBars = false;
+        return true;
     }
+    return false;
 }
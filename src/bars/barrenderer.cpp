@@ -27,6 +27,9 @@ void BarType::Draw(BarRenderer *barRenderer, wxDC &dc, wxRect rc,
         Axis *horizAxis, Axis *vertAxis,
         bool vertical, size_t item, CategoryDataset *dataset)
 {
+    AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+    AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
+
     FOREACH_SERIE(serie, dataset) {
         // bar geometry params
         int width;
@@ -51,10 +54,10 @@ void BarType::Draw(BarRenderer *barRenderer, wxDC &dc, wxRect rc,
         }
 
         // transform base and value to graphics coordinates
-        wxCoord xBaseG = horizAxis->ToGraphics(dc, rc.x, rc.width, xBase);
-        wxCoord yBaseG = vertAxis->ToGraphics(dc, rc.y, rc.height, yBase);
-        wxCoord xG = horizAxis->ToGraphics(dc, rc.x, rc.width, xVal);
-        wxCoord yG = vertAxis->ToGraphics(dc, rc.y, rc.height, yVal);
+        wxCoord xBaseG = horizTransform.ToGraphics(xBase);
+        wxCoord yBaseG = vertTransform.ToGraphics(yBase);
+        wxCoord xG = horizTransform.ToGraphics(xVal);
+        wxCoord yG = vertTransform.ToGraphics(yVal);
 
         wxRect rcBar;
         if (vertical) {
@@ -87,14 +90,8 @@ double BarType::GetMinValue(CategoryDataset *dataset)
     if (dataset->GetCount() == 0)
         return 0;
 
-    double minValue = dataset->GetValue(0, 0);
-
-    FOREACH_SERIE(serie, dataset) {
-        for (size_t n = 0; n < dataset->GetCount(); n++) {
-            minValue = wxMin(minValue, dataset->GetValue(n, serie));
-        }
-    }
-    return wxMin(minValue, m_base);
+    // category values are dataset y values, so use cached dataset bounds
+    return wxMin(dataset->GetMinY(), m_base);
 }
 
 double BarType::GetMaxValue(CategoryDataset *dataset)
@@ -102,14 +99,7 @@ double BarType::GetMaxValue(CategoryDataset *dataset)
     if (dataset->GetCount() == 0)
         return 0;
 
-    double maxValue = dataset->GetValue(0, 0);
-
-    FOREACH_SERIE(serie, dataset) {
-        for (size_t n = 0; n < dataset->GetCount(); n++) {
-            maxValue = wxMax(maxValue, dataset->GetValue(n, serie));
-        }
-    }
-    return maxValue;
+    return dataset->GetMaxY();
 }
 
 //
@@ -151,6 +141,10 @@ StackedBarType::StackedBarType(int barWidth, double base)
 : BarType(base)
 {
     m_barWidth = barWidth;
+
+    m_cachedDataset = NULL;
+    m_cachedVersion = 0;
+    m_cachedMaxValue = 0;
 }
 
 StackedBarType::~StackedBarType()
@@ -178,6 +172,10 @@ double StackedBarType::GetMaxValue(CategoryDataset *dataset)
     if (dataset->GetCount() == 0)
         return 0;
 
+    if (dataset == m_cachedDataset && dataset->GetVersion() == m_cachedVersion) {
+        return m_cachedMaxValue;
+    }
+
     double maxValue = 0;
 
     for (size_t n = 0; n < dataset->GetCount(); n++) {
@@ -188,6 +186,10 @@ double StackedBarType::GetMaxValue(CategoryDataset *dataset)
         }
         maxValue = wxMax(maxValue, sum);
     }
+
+    m_cachedDataset = dataset;
+    m_cachedVersion = dataset->GetVersion();
+    m_cachedMaxValue = maxValue;
     return maxValue;
 }
 
@@ -13,6 +13,7 @@ IMPLEMENT_CLASS(CategoryDataset, XYDataset);
 
 CategoryDataset::CategoryDataset()
 {
+    SetXSorted(true); // x values are category indexes
 }
 
 CategoryDataset::~CategoryDataset()
@@ -24,6 +25,11 @@ bool CategoryDataset::AcceptRenderer(Renderer *renderer)
     return (wxDynamicCast(renderer, BarRenderer) != NULL);
 }
 
+bool CategoryDataset::IsRendererBounds()
+{
+    return true; // bar type calculates bounds, stacked bars sum values
+}
+
 bool CategoryDataset::HasValue(size_t WXUNUSED(index), size_t WXUNUSED(serie))
 {
     return true;
@@ -0,0 +1,105 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    categoryexternaldataset.cpp
+// Purpose: category dataset over caller owned records implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/category/categoryexternaldataset.h>
+
+IMPLEMENT_CLASS(CategoryExternalDataset, CategoryDataset)
+
+CategoryExternalDataset::CategoryExternalDataset(ExternalBuffer *buffer, const wxArrayString &names)
+: m_names(names)
+{
+    wxASSERT_MSG(buffer != NULL, wxT("CategoryExternalDataset: buffer is NULL"));
+
+    m_buffer = buffer;
+}
+
+CategoryExternalDataset::~CategoryExternalDataset()
+{
+    wxDELETE(m_buffer);
+}
+
+void CategoryExternalDataset::AddSerie(const wxString &name, const ExternalField &valueField)
+{
+    Serie serie;
+    serie.name = name;
+    serie.valueField = valueField;
+
+    m_series.push_back(serie);
+    DatasetChanged();
+}
+
+void CategoryExternalDataset::RecordsAppended(size_t count, const wxArrayString &names)
+{
+    if (count == 0) {
+        return ;
+    }
+
+    size_t first = m_buffer->GetCount();
+    m_buffer->SetCount(first + count);
+
+    for (size_t n = 0; n < names.Count(); n++) {
+        m_names.Add(names[n]);
+    }
+
+    for (size_t serie = 0; serie < m_series.size(); serie++) {
+        for (size_t n = first; n < first + count; n++) {
+            ExtendBounds(BOUNDS_Y, m_buffer->GetValue(n, m_series[serie].valueField));
+        }
+    }
+    ExtendBounds(BOUNDS_X, first + count - 1);
+    DatasetChanged(DatasetChange(DATASET_CHANGE_APPEND, DATASET_ALL_SERIES, first, count), false);
+}
+
+double CategoryExternalDataset::GetValue(size_t index, size_t serie)
+{
+    wxCHECK(serie < m_series.size(), 0);
+    return m_buffer->GetValue(index, m_series[serie].valueField);
+}
+
+size_t CategoryExternalDataset::GetSerieCount()
+{
+    return m_series.size();
+}
+
+wxString CategoryExternalDataset::GetName(size_t index)
+{
+    if (index < m_names.Count()) {
+        return m_names[index];
+    }
+    return wxString::Format(wxT("%u"), (unsigned) (index + 1));
+}
+
+size_t CategoryExternalDataset::GetCount()
+{
+    return m_buffer->GetCount();
+}
+
+wxString CategoryExternalDataset::GetSerieName(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), wxEmptyString);
+    return m_series[serie].name;
+}
+
+void CategoryExternalDataset::GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys)
+{
+    wxCHECK_RET(serie < m_series.size(), wxT("CategoryExternalDataset::GetXYBlock"));
+
+    if (xs != NULL) {
+        m_buffer->GetValues(first, count, ExternalField::Index(), xs);
+    }
+    if (ys != NULL) {
+        m_buffer->GetValues(first, count, m_series[serie].valueField, ys);
+    }
+}
+
+const double *CategoryExternalDataset::GetYColumn(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), NULL);
+    return m_buffer->GetColumn(m_series[serie].valueField);
+}
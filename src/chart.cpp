@@ -35,8 +35,8 @@ void Chart::Init(Plot* plot, Header* header, Footer* footer)
     wxColour bgColor = *wxWHITE;
 
     m_background = new FillAreaDraw(
-            *wxThePenList->FindOrCreatePen(bgColor, 1, wxPENSTYLE_SOLID),
-            *wxTheBrushList->FindOrCreateBrush(bgColor));
+            *DrawResources::FindOrCreatePen(bgColor, 1, wxPENSTYLE_SOLID),
+            *DrawResources::FindOrCreateBrush(bgColor));
 
     m_margin = 5;
 
@@ -45,6 +45,7 @@ void Chart::Init(Plot* plot, Header* header, Footer* footer)
     m_header = header;
     m_footer = footer;
     m_headerGap = 2;
+    m_backgroundChanged = true;
 
     m_horizScrolledAxis = NULL;
     m_vertScrolledAxis = NULL;
@@ -136,6 +137,12 @@ void Chart::SetChartPanel(wxChartPanel *chartPanel)
 //}
 
 void Chart::Draw(ChartDC &cdc, wxRect &rc, bool antialias)
+{
+    DrawBackground(cdc, rc);
+    DrawData(cdc, rc);
+}
+
+void Chart::DrawBackground(ChartDC &cdc, wxRect &rc)
 {
     // draw chart background
     m_background->Draw(cdc.GetDC(), rc);
@@ -166,6 +173,82 @@ void Chart::Draw(ChartDC &cdc, wxRect &rc, bool antialias)
     Margins(rc, m_margin, topMargin, m_margin, bottomMargin);
    
     m_plot->Draw(cdc, rc, PLOT_DRAW_BACKGROUND);
-    
-    m_plot->Draw(cdc, rc, PLOT_DRAW_DATA);
+}
+
+void Chart::DrawData(ChartDC &cdc, wxRect rcPlot)
+{
+    m_plot->Draw(cdc, rcPlot, PLOT_DRAW_DATA);
+}
+
+bool Chart::RenderToImage(wxImage &image, const wxSize &size, bool antialias)
+{
+    wxCHECK_MSG(size.x > 0 && size.y > 0, false, wxT("Chart::RenderToImage: invalid size"));
+
+#if wxUSE_GRAPHICS_CONTEXT
+    // unlike wxBitmap and wxMemoryDC, image and graphics
+    // context drawing to it can be used outside of GUI thread
+    if (!image.Create(size.x, size.y)) {
+        return false;
+    }
+
+    wxGraphicsContext *context = wxGraphicsContext::Create(image);
+    if (context == NULL) {
+        return false;
+    }
+    context->SetAntialiasMode(antialias ? wxANTIALIAS_DEFAULT : wxANTIALIAS_NONE);
+
+    {
+        // image is updated, when DC destroys its context
+        wxGCDC gdc(context);
+        ChartDC cdc(gdc, antialias);
+        wxRect rc(0, 0, size.x, size.y);
+
+        Draw(cdc, rc, antialias);
+    }
+    return true;
+#else
+    wxUnusedVar(image);
+    wxUnusedVar(antialias);
+    return false;
+#endif
+}
+
+bool Chart::RenderToRGBA(unsigned char *buffer, const wxSize &size, size_t stride, bool antialias)
+{
+    wxCHECK_MSG(buffer != NULL, false, wxT("Chart::RenderToRGBA: buffer is NULL"));
+    wxCHECK_MSG(stride >= (size_t) size.x * 4, false, wxT("Chart::RenderToRGBA: stride is too small"));
+
+    wxImage image;
+    if (!RenderToImage(image, size, antialias)) {
+        return false;
+    }
+
+    const unsigned char *rgb = image.GetData();
+    const unsigned char *alpha = image.HasAlpha() ? image.GetAlpha() : NULL;
+
+    for (int y = 0; y < size.y; y++) {
+        unsigned char *row = buffer + y * stride;
+
+        for (int x = 0; x < size.x; x++) {
+            row[0] = rgb[0];
+            row[1] = rgb[1];
+            row[2] = rgb[2];
+            row[3] = (alpha != NULL) ? *alpha++ : 255;
+            row += 4;
+            rgb += 3;
+        }
+    }
+    return true;
+}
+
+bool Chart::CheckBackgroundChanged()
+{
+    bool changed = m_backgroundChanged;
+    m_backgroundChanged = false;
+
+    // plot is always checked, to reset its state too
+    if (m_plot->CheckBackgroundChanged()) {
+        changed = true;
+    }
+    return changed;
 }
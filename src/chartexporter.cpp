@@ -0,0 +1,361 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    chartexporter.cpp
+// Purpose: parallel batch chart export implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/chartexporter.h>
+#include <wx/drawresources.h>
+#include <wx/axisplot.h>
+#include <wx/multiplot.h>
+#include <wx/pie/pieplot.h>
+
+#include <wx/image.h>
+
+//
+// ChartExportObserver
+//
+
+ChartExportObserver::ChartExportObserver()
+{
+}
+
+ChartExportObserver::~ChartExportObserver()
+{
+}
+
+//
+// ChartExporter::Worker
+//
+
+ChartExporter::Worker::Worker(ChartExporter *exporter)
+: wxThread(wxTHREAD_JOINABLE)
+{
+    m_exporter = exporter;
+}
+
+wxThread::ExitCode ChartExporter::Worker::Entry()
+{
+    m_exporter->RunJobs();
+
+    DrawResources::ReleaseThreadCache();
+    return 0;
+}
+
+//
+// ChartExporter
+//
+
+ChartExporter::ChartExporter(bool antialias)
+: m_condition(m_mutex)
+{
+    m_antialias = antialias;
+    m_observer = NULL;
+
+    m_firstPending = 0;
+    m_pendingCount = 0;
+    m_finishedCount = 0;
+    m_failedCount = 0;
+
+    m_cancelled = false;
+    m_started = false;
+}
+
+ChartExporter::~ChartExporter()
+{
+    Cancel();
+    Wait();
+}
+
+size_t ChartExporter::AddJob(Chart *chart, const wxSize &size, const wxString &path)
+{
+    return AddJob(chart, size, path, NULL);
+}
+
+size_t ChartExporter::AddJob(Chart *chart, const wxSize &size, wxOutputStream *stream)
+{
+    wxCHECK_MSG(stream != NULL, (size_t) -1, wxT("ChartExporter::AddJob: stream is NULL"));
+
+    return AddJob(chart, size, wxEmptyString, stream);
+}
+
+size_t ChartExporter::AddJob(Chart *chart, const wxSize &size, const wxString &path, wxOutputStream *stream)
+{
+    wxCHECK_MSG(chart != NULL, (size_t) -1, wxT("ChartExporter::AddJob: chart is NULL"));
+    wxCHECK_MSG(!m_started, (size_t) -1, wxT("ChartExporter::AddJob: export is started"));
+
+    Job job;
+    job.chart = chart;
+    job.size = size;
+    job.path = path;
+    job.stream = stream;
+    job.state = CHART_EXPORT_PENDING;
+    job.started = false;
+
+    // plot caches are changed by drawing, and so are
+    // datasets bounds caches and their renderers buffers
+    job.resources.push_back(chart);
+    AddPlotResources(job, chart->GetPlot());
+
+    m_jobs.push_back(job);
+    m_pendingCount++;
+    return m_jobs.size() - 1;
+}
+
+void ChartExporter::AddPlotResources(Job &job, Plot *plot)
+{
+    if (plot == NULL) {
+        return ;
+    }
+
+    // subplots can be shared by charts too
+    job.resources.push_back(plot);
+
+    AxisPlot *axisPlot = dynamic_cast<AxisPlot *>(plot);
+    if (axisPlot != NULL) {
+        for (size_t n = 0; n < axisPlot->GetDatasetCount(); n++) {
+            job.resources.push_back(axisPlot->GetDataset(n));
+        }
+    }
+
+    MultiPlot *multiPlot = dynamic_cast<MultiPlot *>(plot);
+    if (multiPlot != NULL) {
+        for (size_t n = 0; n < multiPlot->GetPlotCount(); n++) {
+            AddPlotResources(job, multiPlot->GetPlot(n));
+        }
+    }
+
+    PiePlot *piePlot = dynamic_cast<PiePlot *>(plot);
+    if (piePlot != NULL && piePlot->GetDataset() != NULL) {
+        job.resources.push_back(piePlot->GetDataset());
+    }
+}
+
+void ChartExporter::SetObserver(ChartExportObserver *observer)
+{
+    wxCHECK_RET(!m_started, wxT("ChartExporter::SetObserver: export is started"));
+
+    m_observer = observer;
+}
+
+bool ChartExporter::Start(size_t threadCount)
+{
+    wxCHECK_MSG(!m_started, false, wxT("ChartExporter::Start: export is started"));
+
+    m_started = true;
+
+    if (m_jobs.size() == 0) {
+        return false;
+    }
+
+    // handlers list is not thread safe, so handler is added here
+    if (wxImage::FindHandler(wxBITMAP_TYPE_PNG) == NULL) {
+        wxImage::AddHandler(new wxPNGHandler());
+    }
+
+    if (threadCount == 0) {
+        int cpuCount = wxThread::GetCPUCount();
+        threadCount = (cpuCount > 0) ? (size_t) cpuCount : 1;
+    }
+    threadCount = wxMin(threadCount, m_jobs.size());
+
+    for (size_t n = 0; n < threadCount; n++) {
+        Worker *worker = new Worker(this);
+
+        if (worker->Run() != wxTHREAD_NO_ERROR) {
+            delete worker;
+            break;
+        }
+        m_workers.push_back(worker);
+    }
+
+    if (m_workers.size() == 0) {
+        Cancel();
+        return false;
+    }
+    return true;
+}
+
+void ChartExporter::Cancel()
+{
+    wxMutexLocker lock(m_mutex);
+
+    m_cancelled = true;
+
+    for (size_t n = m_firstPending; n < m_jobs.size(); n++) {
+        if (!m_jobs[n].started) {
+            m_jobs[n].state = CHART_EXPORT_CANCELLED;
+        }
+    }
+    m_pendingCount = 0;
+
+    // wake workers, waiting for busy charts
+    m_condition.Broadcast();
+}
+
+void ChartExporter::Wait()
+{
+    for (size_t n = 0; n < m_workers.size(); n++) {
+        m_workers[n]->Wait();
+        delete m_workers[n];
+    }
+    m_workers.clear();
+}
+
+bool ChartExporter::IsCancelled()
+{
+    wxMutexLocker lock(m_mutex);
+    return m_cancelled;
+}
+
+bool ChartExporter::IsFinished()
+{
+    wxMutexLocker lock(m_mutex);
+
+    for (size_t n = 0; n < m_jobs.size(); n++) {
+        if (m_jobs[n].state == CHART_EXPORT_PENDING) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t ChartExporter::GetJobCount()
+{
+    wxMutexLocker lock(m_mutex);
+    return m_jobs.size();
+}
+
+size_t ChartExporter::GetFinishedCount()
+{
+    wxMutexLocker lock(m_mutex);
+    return m_finishedCount;
+}
+
+size_t ChartExporter::GetFailedCount()
+{
+    wxMutexLocker lock(m_mutex);
+    return m_failedCount;
+}
+
+CHART_EXPORT_STATE ChartExporter::GetJobState(size_t index)
+{
+    wxMutexLocker lock(m_mutex);
+
+    wxCHECK_MSG(index < m_jobs.size(), CHART_EXPORT_FAILED, wxT("ChartExporter::GetJobState"));
+    return m_jobs[index].state;
+}
+
+void ChartExporter::RunJobs()
+{
+    m_mutex.Lock();
+
+    while (m_pendingCount != 0) {
+        size_t index;
+
+        if (!TakeJob(index)) {
+            // all pending jobs share charts or datasets with running ones
+            m_condition.Wait();
+            continue;
+        }
+
+        // jobs are not added after start, so reference stays valid
+        Job &job = m_jobs[index];
+        m_mutex.Unlock();
+
+        wxImage image;
+        bool ok = job.chart->RenderToImage(image, job.size, m_antialias);
+
+        m_mutex.Lock();
+        ReleaseResources(job);
+        m_mutex.Unlock();
+
+        // encoding needs no shared objects, so
+        // other jobs can render same chart meanwhile
+        if (ok) {
+            ok = SaveImage(job, image);
+        }
+
+        CHART_EXPORT_STATE state = ok ? CHART_EXPORT_DONE : CHART_EXPORT_FAILED;
+
+        m_mutex.Lock();
+        job.state = state;
+        m_finishedCount++;
+        if (!ok) {
+            m_failedCount++;
+        }
+        m_mutex.Unlock();
+
+        if (m_observer != NULL) {
+            m_observer->JobFinished(this, index, state);
+        }
+
+        m_mutex.Lock();
+    }
+
+    m_mutex.Unlock();
+}
+
+bool ChartExporter::TakeJob(size_t &index)
+{
+    // skip started jobs at queue head
+    while (m_firstPending < m_jobs.size() && m_jobs[m_firstPending].started) {
+        m_firstPending++;
+    }
+
+    for (size_t n = m_firstPending; n < m_jobs.size(); n++) {
+        Job &job = m_jobs[n];
+
+        if (job.started || IsBusy(job)) {
+            continue;
+        }
+
+        for (size_t nRes = 0; nRes < job.resources.size(); nRes++) {
+            m_busy.push_back(job.resources[nRes]);
+        }
+        job.started = true;
+        m_pendingCount--;
+
+        index = n;
+        return true;
+    }
+    return false;
+}
+
+bool ChartExporter::IsBusy(const Job &job)
+{
+    for (size_t nRes = 0; nRes < job.resources.size(); nRes++) {
+        for (size_t n = 0; n < m_busy.size(); n++) {
+            if (m_busy[n] == job.resources[nRes]) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void ChartExporter::ReleaseResources(const Job &job)
+{
+    for (size_t nRes = 0; nRes < job.resources.size(); nRes++) {
+        for (size_t n = 0; n < m_busy.size(); n++) {
+            if (m_busy[n] == job.resources[nRes]) {
+                m_busy.erase(m_busy.begin() + n);
+                break;
+            }
+        }
+    }
+
+    // jobs, waiting for these resources, can be started now
+    m_condition.Broadcast();
+}
+
+bool ChartExporter::SaveImage(const Job &job, const wxImage &image)
+{
+    if (job.stream != NULL) {
+        return image.SaveFile(*job.stream, wxBITMAP_TYPE_PNG);
+    }
+    return image.SaveFile(job.path, wxBITMAP_TYPE_PNG);
+}
@@ -93,6 +93,7 @@ wxChartPanel::wxChartPanel(wxWindow *parent, wxWindowID id, Chart *chart, const
     m_chart = NULL;
     m_antialias = false;
     m_rerender = false;
+    m_staticValid = false;
     m_mode = NULL;
 
     ResizeBackBitmap(size);
@@ -124,6 +125,7 @@ void wxChartPanel::SetChart(Chart *chart)
 
     //RedrawBackBitmap();
     m_rerender = true;
+    m_staticValid = false;
     Refresh(false);
 }
 
@@ -156,6 +158,7 @@ void wxChartPanel::SetAntialias(bool antialias)
 
         //RedrawBackBitmap();
         m_rerender = true;
+        m_staticValid = false;
         Refresh(false);
     }
 }
@@ -341,13 +344,31 @@ void wxChartPanel::RedrawBackBitmap()
 {
     if (m_chart != NULL) 
     {
+        // static layer (background, header, axes, grid, legend) is redrawn
+        // only when it changed, otherwise only data is drawn over its copy
+        if (m_chart->CheckBackgroundChanged()) {
+            m_staticValid = false;
+        }
+
+        if (!m_staticValid) {
+            wxMemoryDC sdc;
+            sdc.SelectObject(m_staticBitmap);
+
+            m_plotRect = GetClientRect();
+
+            ChartDC scdc (sdc, m_antialias);
+            m_chart->DrawBackground(scdc, m_plotRect);
+
+            sdc.SelectObject(wxNullBitmap);
+            m_staticValid = true;
+        }
+
         wxMemoryDC mdc;
         mdc.SelectObject(m_backBitmap);
+        mdc.DrawBitmap(m_staticBitmap, 0, 0, false);
 
-        const wxRect& rc = GetClientRect();
-        
         ChartDC cdc (mdc, m_antialias);
-        m_chart->Draw(cdc, (wxRect&)rc, m_antialias);
+        m_chart->DrawData(cdc, m_plotRect);
     }
 }
 
@@ -358,4 +379,6 @@ void wxChartPanel::ResizeBackBitmap(wxSize size)
     size.IncTo(wxSize(1, 1)); 
     
     m_backBitmap.Create(size.GetWidth(), size.GetHeight());
+    m_staticBitmap.Create(size.GetWidth(), size.GetHeight());
+    m_staticValid = false;
 }
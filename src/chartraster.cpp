@@ -0,0 +1,313 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    chartraster.cpp
+// Purpose: software rasterizer for aliased chart primitives implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/chartraster.h>
+
+#include <math.h>
+
+// Cohen-Sutherland outcodes
+#define OUT_LEFT 1
+#define OUT_RIGHT 2
+#define OUT_TOP 4
+#define OUT_BOTTOM 8
+
+ChartRaster::ChartRaster(unsigned char *origin, int width, int height, int stride, int pixelSize,
+        int redOffset, int greenOffset, int blueOffset, int alphaOffset)
+{
+    Init(origin, width, height, stride, pixelSize, redOffset, greenOffset, blueOffset, alphaOffset);
+}
+
+ChartRaster::ChartRaster(wxNativePixelData &data)
+{
+    wxNativePixelData::Iterator it = data.GetPixels();
+
+    Init(it.m_ptr, data.GetWidth(), data.GetHeight(), data.GetRowStride(),
+            wxNativePixelFormat::SizePixel, wxNativePixelFormat::RED,
+            wxNativePixelFormat::GREEN, wxNativePixelFormat::BLUE, wxNativePixelFormat::ALPHA);
+}
+
+ChartRaster::ChartRaster(wxImage &image)
+{
+    // image alpha is separate plane, so it is not changed
+    Init(image.GetData(), image.GetWidth(), image.GetHeight(), image.GetWidth() * 3, 3, 0, 1, 2, -1);
+}
+
+ChartRaster::~ChartRaster()
+{
+}
+
+void ChartRaster::Init(unsigned char *origin, int width, int height, int stride, int pixelSize,
+        int redOffset, int greenOffset, int blueOffset, int alphaOffset)
+{
+    wxASSERT_MSG(pixelSize >= 3 && pixelSize <= 4, wxT("ChartRaster: unsupported pixel size"));
+
+    m_origin = origin;
+    m_width = (origin != NULL) ? width : 0;
+    m_height = (origin != NULL) ? height : 0;
+    m_stride = stride;
+    m_pixelSize = pixelSize;
+
+    m_redOffset = redOffset;
+    m_greenOffset = greenOffset;
+    m_blueOffset = blueOffset;
+    m_alphaOffset = alphaOffset;
+
+    m_offsetX = 0;
+    m_offsetY = 0;
+    m_lineWidth = 1;
+
+    m_clipLeft = 0;
+    m_clipTop = 0;
+    m_clipRight = m_width - 1;
+    m_clipBottom = m_height - 1;
+
+    SetColour(*wxBLACK);
+}
+
+void ChartRaster::SetOffset(wxCoord x, wxCoord y)
+{
+    wxRect clip = GetClippingRect();
+
+    m_offsetX = x;
+    m_offsetY = y;
+    SetClippingRect(clip);
+}
+
+void ChartRaster::SetClippingRect(const wxRect &rc)
+{
+    m_clipLeft = wxMax(rc.x + m_offsetX, 0);
+    m_clipTop = wxMax(rc.y + m_offsetY, 0);
+    m_clipRight = wxMin(rc.x + rc.width - 1 + m_offsetX, m_width - 1);
+    m_clipBottom = wxMin(rc.y + rc.height - 1 + m_offsetY, m_height - 1);
+}
+
+wxRect ChartRaster::GetClippingRect() const
+{
+    return wxRect(m_clipLeft - m_offsetX, m_clipTop - m_offsetY,
+            m_clipRight - m_clipLeft + 1, m_clipBottom - m_clipTop + 1);
+}
+
+void ChartRaster::SetColour(const wxColour &colour)
+{
+    for (int n = 0; n < 4; n++) {
+        m_pixel[n] = 0;
+    }
+
+    m_pixel[m_redOffset] = colour.Red();
+    m_pixel[m_greenOffset] = colour.Green();
+    m_pixel[m_blueOffset] = colour.Blue();
+    if (m_alphaOffset >= 0) {
+        m_pixel[m_alphaOffset] = 255;
+    }
+}
+
+void ChartRaster::SetLineWidth(int width)
+{
+    m_lineWidth = wxMax(width, 1);
+}
+
+void ChartRaster::DrawLine(wxCoord x0, wxCoord y0, wxCoord x1, wxCoord y1)
+{
+    // pen tip covers pixels from x - before to x + after
+    int before = (m_lineWidth - 1) / 2;
+    int after = m_lineWidth - 1 - before;
+    int margin = wxMax(before, after);
+
+    // coordinates can be far outside of buffer, so
+    // line is clipped in floating point first
+    double fx0 = x0 + m_offsetX;
+    double fy0 = y0 + m_offsetY;
+    double fx1 = x1 + m_offsetX;
+    double fy1 = y1 + m_offsetY;
+
+    if (!ClipLine(fx0, fy0, fx1, fy1, margin)) {
+        return ;
+    }
+
+    int left = m_clipLeft - margin;
+    int top = m_clipTop - margin;
+    int right = m_clipRight + margin;
+    int bottom = m_clipBottom + margin;
+
+    int ix0 = wxMin(wxMax((int) floor(fx0 + 0.5), left), right);
+    int iy0 = wxMin(wxMax((int) floor(fy0 + 0.5), top), bottom);
+    int ix1 = wxMin(wxMax((int) floor(fx1 + 0.5), left), right);
+    int iy1 = wxMin(wxMax((int) floor(fy1 + 0.5), top), bottom);
+
+    if (iy0 == iy1 || ix0 == ix1) {
+        // horizontal and vertical lines are single box
+        FillBox(wxMin(ix0, ix1) - before, wxMin(iy0, iy1) - before,
+                wxMax(ix0, ix1) + after, wxMax(iy0, iy1) + after);
+        return ;
+    }
+
+    // Bresenham algorithm
+    int dx = abs(ix1 - ix0);
+    int dy = -abs(iy1 - iy0);
+    int sx = (ix0 < ix1) ? 1 : -1;
+    int sy = (iy0 < iy1) ? 1 : -1;
+    int err = dx + dy;
+
+    for (;;) {
+        if (m_lineWidth == 1) {
+            PutPixel(ix0, iy0);
+        }
+        else {
+            FillBox(ix0 - before, iy0 - before, ix0 + after, iy0 + after);
+        }
+
+        if (ix0 == ix1 && iy0 == iy1) {
+            break;
+        }
+
+        int e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            ix0 += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            iy0 += sy;
+        }
+    }
+}
+
+void ChartRaster::DrawLines(size_t count, const wxPoint *points)
+{
+    if (count == 1) {
+        DrawLine(points[0].x, points[0].y, points[0].x, points[0].y);
+    }
+
+    for (size_t n = 1; n < count; n++) {
+        DrawLine(points[n - 1].x, points[n - 1].y, points[n].x, points[n].y);
+    }
+}
+
+void ChartRaster::FillRectangle(wxCoord x, wxCoord y, wxCoord width, wxCoord height)
+{
+    FillBox(x + m_offsetX, y + m_offsetY, x + width - 1 + m_offsetX, y + height - 1 + m_offsetY);
+}
+
+void ChartRaster::FillCircle(wxCoord x, wxCoord y, wxCoord radius)
+{
+    int cx = x + m_offsetX;
+    int cy = y + m_offsetY;
+
+    // whole circle is outside of clipping rectangle
+    if (cx + radius < m_clipLeft || cx - radius > m_clipRight
+            || cy + radius < m_clipTop || cy - radius > m_clipBottom) {
+        return ;
+    }
+
+    // span half width for each row is found incrementally, point is inside
+    // when dx^2 + dy^2 <= r^2 + r, which matches midpoint circle outline
+    int limit = radius * radius + radius;
+    int dx = radius;
+
+    for (int dy = 0; dy <= radius; dy++) {
+        while (dx > 0 && dx * dx + dy * dy > limit) {
+            dx--;
+        }
+
+        int left = wxMax(cx - dx, m_clipLeft);
+        int right = wxMin(cx + dx, m_clipRight);
+
+        if (cy - dy >= m_clipTop && cy - dy <= m_clipBottom) {
+            FillSpan(left, right, cy - dy);
+        }
+        if (dy != 0 && cy + dy >= m_clipTop && cy + dy <= m_clipBottom) {
+            FillSpan(left, right, cy + dy);
+        }
+    }
+}
+
+void ChartRaster::FillSpan(int x0, int x1, int y)
+{
+    if (x0 > x1) {
+        return ;
+    }
+
+    unsigned char *p = m_origin + y * m_stride + x0 * m_pixelSize;
+
+    for (int x = x0; x <= x1; x++) {
+        for (int n = 0; n < m_pixelSize; n++) {
+            p[n] = m_pixel[n];
+        }
+        p += m_pixelSize;
+    }
+}
+
+void ChartRaster::FillBox(int left, int top, int right, int bottom)
+{
+    left = wxMax(left, m_clipLeft);
+    top = wxMax(top, m_clipTop);
+    right = wxMin(right, m_clipRight);
+    bottom = wxMin(bottom, m_clipBottom);
+
+    for (int row = top; row <= bottom; row++) {
+        FillSpan(left, right, row);
+    }
+}
+
+bool ChartRaster::ClipLine(double &x0, double &y0, double &x1, double &y1, int margin)
+{
+    // wide lines are clipped by rectangle, widened by pen tip
+    const double left = m_clipLeft - margin;
+    const double top = m_clipTop - margin;
+    const double right = m_clipRight + margin;
+    const double bottom = m_clipBottom + margin;
+
+    if (left > right || top > bottom) {
+        return false;
+    }
+
+    for (;;) {
+        int code0 = (x0 < left ? OUT_LEFT : 0) | (x0 > right ? OUT_RIGHT : 0)
+                | (y0 < top ? OUT_TOP : 0) | (y0 > bottom ? OUT_BOTTOM : 0);
+        int code1 = (x1 < left ? OUT_LEFT : 0) | (x1 > right ? OUT_RIGHT : 0)
+                | (y1 < top ? OUT_TOP : 0) | (y1 > bottom ? OUT_BOTTOM : 0);
+
+        if ((code0 | code1) == 0) {
+            return true;
+        }
+        if ((code0 & code1) != 0) {
+            return false;
+        }
+
+        // move outside point to clipping rectangle edge
+        int code = (code0 != 0) ? code0 : code1;
+        double x, y;
+
+        if (code & OUT_LEFT) {
+            x = left;
+            y = y0 + (y1 - y0) * (left - x0) / (x1 - x0);
+        }
+        else if (code & OUT_RIGHT) {
+            x = right;
+            y = y0 + (y1 - y0) * (right - x0) / (x1 - x0);
+        }
+        else if (code & OUT_TOP) {
+            y = top;
+            x = x0 + (x1 - x0) * (top - y0) / (y1 - y0);
+        }
+        else {
+            y = bottom;
+            x = x0 + (x1 - x0) * (bottom - y0) / (y1 - y0);
+        }
+
+        if (code == code0) {
+            x0 = x;
+            y0 = y;
+        }
+        else {
+            x1 = x;
+            y1 = y;
+        }
+    }
+}
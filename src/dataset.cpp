@@ -19,6 +19,32 @@ DatasetObserver::~DatasetObserver()
 {
 }
 
+void DatasetObserver::DatasetChanged(Dataset *dataset, const DatasetChange &WXUNUSED(change))
+{
+    DatasetChanged(dataset);
+}
+
+//
+// DatasetChange
+//
+
+void DatasetChange::Merge(const DatasetChange &change)
+{
+    if (m_kind != change.m_kind) {
+        Set(DATASET_CHANGE_ALL, DATASET_ALL_SERIES, 0, 0);
+        return ;
+    }
+
+    if (m_serie != change.m_serie) {
+        m_serie = DATASET_ALL_SERIES;
+    }
+
+    // union of ranges
+    size_t end = wxMax(m_first + m_count, change.m_first + change.m_count);
+    m_first = wxMin(m_first, change.m_first);
+    m_count = end - m_first;
+}
+
 //
 // Dataset
 //
@@ -28,8 +54,11 @@ IMPLEMENT_CLASS(Dataset, wxObject)
 Dataset::Dataset()
 {
     m_renderer = NULL;
-    m_updating = false;
+    m_updateCount = 0;
     m_changed = false;
+    m_removed = false;
+    m_version = 0;
+    m_modifyVersion = 0;
 }
 
 Dataset::~Dataset()
@@ -47,7 +76,7 @@ void Dataset::SetRenderer(Renderer *renderer)
 {
     SAFE_REPLACE_OBSERVER(this, m_renderer, renderer);
     SAFE_REPLACE_UNREF(m_renderer, renderer);
-    DatasetChanged();
+    RendererChanged();
 }
 
 Renderer *Dataset::GetBaseRenderer()
@@ -57,35 +86,172 @@ Renderer *Dataset::GetBaseRenderer()
 
 void Dataset::NeedRedraw(DrawObject *WXUNUSED(obj))
 {
-    DatasetChanged();
+    // renderer or marker is changed, values are same
+    RendererChanged();
+}
+
+void Dataset::RendererChanged()
+{
+    // axes must be updated, if renderer calculates bounds (eg. stacked bars)
+    DATASET_CHANGE_KIND kind = IsRendererBounds() ? DATASET_CHANGE_ALL : DATASET_CHANGE_RENDERER;
+
+    DatasetChanged(DatasetChange(kind), false);
+}
+
+bool Dataset::IsRendererBounds()
+{
+    return false;
 }
 
 void Dataset::BeginUpdate()
 {
-    m_updating = true;
+    m_updateCount++;
 }
 
 void Dataset::EndUpdate()
 {
-    if (m_updating) {
-        m_updating = false;
-        if (m_changed) {
-            FireDatasetChanged();
-        }
+    wxCHECK_RET(m_updateCount > 0, wxT("Dataset::EndUpdate: no matching BeginUpdate"));
+
+    m_updateCount--;
+    if (m_updateCount != 0) {
+        return ;
+    }
+
+    if (m_removed) {
+        m_removed = false;
+        FireDatasetChanged(m_pendingRemove);
+    }
+    if (m_changed) {
+        m_changed = false;
+        FireDatasetChanged(m_pendingChange);
     }
 }
 
-void Dataset::DatasetChanged()
+void Dataset::DatasetChanged(bool invalidateBounds)
 {
-    if (m_updating) {
-        m_changed = true;
+    DatasetChanged(DatasetChange(), invalidateBounds);
+}
+
+void Dataset::DatasetChanged(const DatasetChange &change, bool invalidateBounds)
+{
+    if (invalidateBounds) {
+        InvalidateBounds();
+    }
+    m_version++;
+    if (change.GetKind() != DATASET_CHANGE_APPEND && change.IsValuesChanged()) {
+        m_modifyVersion = m_version;
+    }
+    UpdateCaches(change);
+
+    if (m_updateCount != 0) {
+        MergeChange(change);
     }
     else {
-        FireDatasetChanged();
+        FireDatasetChanged(change);
         m_changed = false;
+        m_removed = false;
     }
 }
 
+void Dataset::MergeChange(const DatasetChange &change)
+{
+    bool frontRemove = change.GetKind() == DATASET_CHANGE_REMOVE && change.GetFirst() == 0;
+
+    // removals from serie start are kept apart from appends, so streaming
+    // datasets are reported as scrolled, not as changed anywhere
+    if (frontRemove && (!m_changed || m_pendingChange.GetKind() == DATASET_CHANGE_APPEND)) {
+        if (m_changed && change.AffectsSerie(m_pendingChange.GetSerie())) {
+            // appended values are moved to serie start
+            size_t first = m_pendingChange.GetFirst();
+            size_t end = first + m_pendingChange.GetCount();
+            size_t count = change.GetCount();
+
+            first = (first > count) ? first - count : 0;
+            end = (end > count) ? end - count : 0;
+            m_pendingChange = DatasetChange(DATASET_CHANGE_APPEND, m_pendingChange.GetSerie(), first, end - first);
+        }
+
+        if (!m_removed) {
+            m_pendingRemove = change;
+            m_removed = true;
+        }
+        else if (m_pendingRemove.GetSerie() == change.GetSerie()) {
+            m_pendingRemove = DatasetChange(DATASET_CHANGE_REMOVE, change.GetSerie(),
+                    0, m_pendingRemove.GetCount() + change.GetCount());
+        }
+        else {
+            m_pendingRemove.Merge(change);
+        }
+        return ;
+    }
+
+    if (m_changed) {
+        m_pendingChange.Merge(change);
+    }
+    else {
+        m_pendingChange = change;
+        m_changed = true;
+    }
+
+    if (m_removed && m_pendingChange.GetKind() != DATASET_CHANGE_APPEND) {
+        // removal can't be reported apart, when it is followed by other changes
+        m_pendingRemove.Merge(m_pendingChange);
+        m_pendingChange = m_pendingRemove;
+        m_removed = false;
+    }
+}
+
+bool Dataset::GetBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue)
+{
+    DatasetBounds &bounds = m_bounds[dim];
+
+    if (!bounds.IsValid()) {
+        double minV = 0, maxV = 0;
+        bool hasValues = CalcBounds(dim, minV, maxV);
+
+        bounds.Set(!hasValues, minV, maxV);
+    }
+
+    minValue = bounds.GetMinValue();
+    maxValue = bounds.GetMaxValue();
+    return !bounds.IsEmpty();
+}
+
+bool Dataset::CalcBounds(BOUNDS_DIMENSION WXUNUSED(dim), double &WXUNUSED(minValue), double &WXUNUSED(maxValue))
+{
+    return false;
+}
+
+void Dataset::ExtendBounds(BOUNDS_DIMENSION dim, double value)
+{
+    m_bounds[dim].Extend(value);
+}
+
+void Dataset::ValueRemoved(BOUNDS_DIMENSION dim, double value)
+{
+    DatasetBounds &bounds = m_bounds[dim];
+
+    if (bounds.IsValid() && bounds.IsExtreme(value)) {
+        bounds.Invalidate();
+    }
+}
+
+void Dataset::InvalidateBounds(BOUNDS_DIMENSION dim)
+{
+    m_bounds[dim].Invalidate();
+}
+
+void Dataset::InvalidateBounds()
+{
+    for (size_t n = 0; n < BOUNDS_DIMENSION_COUNT; n++) {
+        m_bounds[n].Invalidate();
+    }
+}
+
+void Dataset::UpdateCaches(const DatasetChange &WXUNUSED(change))
+{
+}
+
 void Dataset::AddMarker(Marker *marker)
 {
     marker->AddObserver(this);
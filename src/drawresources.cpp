@@ -0,0 +1,110 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    drawresources.cpp
+// Purpose: thread local pen and brush caches implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/drawresources.h>
+
+#include <wx/module.h>
+#include <wx/thread.h>
+#include <wx/tls.h>
+#include <wx/vector.h>
+
+/**
+ * Pens and brushes of one thread.
+ * Charts use few colours, so linear search is fast enough.
+ */
+struct DrawResourcesCache
+{
+    ~DrawResourcesCache()
+    {
+        for (size_t n = 0; n < pens.size(); n++) {
+            delete pens[n];
+        }
+        for (size_t n = 0; n < brushes.size(); n++) {
+            delete brushes[n];
+        }
+    }
+
+    wxVector<wxPen *> pens;
+    wxVector<wxBrush *> brushes;
+};
+
+// wxTLS_TYPE supports only POD types, so cache is allocated on first use
+static wxTLS_TYPE(DrawResourcesCache *) s_threadCache;
+
+static DrawResourcesCache &GetThreadCache()
+{
+    DrawResourcesCache *&cache = wxTLS_VALUE(s_threadCache);
+
+    if (cache == NULL) {
+        cache = new DrawResourcesCache();
+    }
+    return *cache;
+}
+
+/**
+ * Releases cache of main thread on library cleanup,
+ * while wx GDI objects can be still deleted.
+ */
+class DrawResourcesModule : public wxModule
+{
+    DECLARE_DYNAMIC_CLASS(DrawResourcesModule)
+public:
+    virtual bool OnInit()
+    {
+        return true;
+    }
+
+    virtual void OnExit()
+    {
+        DrawResources::ReleaseThreadCache();
+    }
+};
+
+IMPLEMENT_DYNAMIC_CLASS(DrawResourcesModule, wxModule)
+
+void DrawResources::ReleaseThreadCache()
+{
+    DrawResourcesCache *&cache = wxTLS_VALUE(s_threadCache);
+
+    wxDELETE(cache);
+}
+
+wxPen *DrawResources::FindOrCreatePen(const wxColour &colour, int width, wxPenStyle style)
+{
+    wxVector<wxPen *> &pens = GetThreadCache().pens;
+
+    for (size_t n = 0; n < pens.size(); n++) {
+        wxPen *pen = pens[n];
+
+        if (pen->GetWidth() == width && pen->GetStyle() == style && pen->GetColour() == colour) {
+            return pen;
+        }
+    }
+
+    wxPen *pen = new wxPen(colour, width, style);
+    pens.push_back(pen);
+    return pen;
+}
+
+wxBrush *DrawResources::FindOrCreateBrush(const wxColour &colour, wxBrushStyle style)
+{
+    wxVector<wxBrush *> &brushes = GetThreadCache().brushes;
+
+    for (size_t n = 0; n < brushes.size(); n++) {
+        wxBrush *brush = brushes[n];
+
+        if (brush->GetStyle() == style && brush->GetColour() == colour) {
+            return brush;
+        }
+    }
+
+    wxBrush *brush = new wxBrush(colour, style);
+    brushes.push_back(brush);
+    return brush;
+}
@@ -0,0 +1,90 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    externalbuffer.cpp
+// Purpose: caller owned record buffer implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/externalbuffer.h>
+
+template<typename T> static void ReadStrided(const char *p, size_t stride, size_t count, double *values)
+{
+    for (size_t n = 0; n < count; n++, p += stride) {
+        T v;
+        memcpy(&v, p, sizeof(v));
+        values[n] = (double) v;
+    }
+}
+
+ExternalBuffer::ExternalBuffer(const void *base, size_t stride, size_t count,
+        ExternalBufferRelease release, void *userData)
+{
+    m_base = (const char *) base;
+    m_stride = stride;
+    m_count = count;
+    m_release = release;
+    m_userData = userData;
+}
+
+ExternalBuffer::~ExternalBuffer()
+{
+    if (m_release != NULL) {
+        (*m_release)(m_base, m_userData);
+    }
+}
+
+void ExternalBuffer::GetValues(size_t first, size_t count, const ExternalField &field, double *values) const
+{
+    wxCHECK_RET(first + count <= m_count, wxT("ExternalBuffer::GetValues"));
+
+    const char *p = m_base + first * m_stride + field.offset;
+
+    // type is dispatched once per range, not once per value
+    switch (field.type) {
+    case FIELD_DOUBLE:
+        if (m_stride == sizeof(double)) {
+            memcpy(values, p, count * sizeof(double));
+        }
+        else {
+            ReadStrided<double>(p, m_stride, count, values);
+        }
+        break;
+    case FIELD_FLOAT:
+        ReadStrided<float>(p, m_stride, count, values);
+        break;
+    case FIELD_INT16:
+        ReadStrided<wxInt16>(p, m_stride, count, values);
+        break;
+    case FIELD_INT32:
+        ReadStrided<wxInt32>(p, m_stride, count, values);
+        break;
+    case FIELD_INT64:
+        ReadStrided<wxInt64>(p, m_stride, count, values);
+        break;
+    case FIELD_INDEX:
+        for (size_t n = 0; n < count; n++) {
+            values[n] = first + n;
+        }
+        break;
+    default:
+        for (size_t n = 0; n < count; n++) {
+            values[n] = 0;
+        }
+        break;
+    }
+}
+
+const double *ExternalBuffer::GetColumn(const ExternalField &field) const
+{
+    if (field.type != FIELD_DOUBLE || m_stride != sizeof(double) || m_count == 0) {
+        return NULL;
+    }
+
+    const char *p = m_base + field.offset;
+    if (((wxUIntPtr) p) % sizeof(double) != 0) {
+        return NULL;
+    }
+    return (const double *) p;
+}
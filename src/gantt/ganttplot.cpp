@@ -33,19 +33,17 @@ bool GanttPlot::AcceptDataset(Dataset *dataset)
     return (wxDynamicCast(dataset, GanttDataset) != NULL);
 }
 
-void GanttPlot::DrawDatasets(wxDC &dc, wxRect rc)
+void GanttPlot::DrawDataset(wxDC &dc, wxRect rc, Dataset *dataset)
 {
-    for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
-        GanttDataset *dataset = (GanttDataset *) GetDataset(nData);
-        GanttRenderer *renderer = dataset->GetRenderer();
-        wxCHECK_RET(renderer != NULL, wxT("no renderer for data"));
+    GanttDataset *ganttDataset = (GanttDataset *) dataset;
+    GanttRenderer *renderer = ganttDataset->GetRenderer();
+    wxCHECK_RET(renderer != NULL, wxT("no renderer for data"));
 
-        CategoryAxis *vertAxis = wxDynamicCast(GetDatasetVerticalAxis(dataset), CategoryAxis);
-        DateAxis *horizAxis = wxDynamicCast(GetDatasetHorizontalAxis(dataset), DateAxis);
+    CategoryAxis *vertAxis = wxDynamicCast(GetDatasetVerticalAxis(dataset), CategoryAxis);
+    DateAxis *horizAxis = wxDynamicCast(GetDatasetHorizontalAxis(dataset), DateAxis);
 
-        wxCHECK_RET(vertAxis != NULL, wxT("no axis for data"));
-        wxCHECK_RET(horizAxis != NULL, wxT("no axis for data"));
+    wxCHECK_RET(vertAxis != NULL, wxT("no axis for data"));
+    wxCHECK_RET(horizAxis != NULL, wxT("no axis for data"));
 
-        renderer->Draw(dc, rc, horizAxis, vertAxis, dataset);
-    }
+    renderer->Draw(dc, rc, horizAxis, vertAxis, ganttDataset);
 }
@@ -29,6 +29,9 @@ void GanttRenderer::Draw(wxDC &dc, wxRect rc, DateAxis *horizAxis, CategoryAxis
     time_t minDate = dataset->GetMinStart();
     time_t maxDate = dataset->GetMaxEnd();
 
+    AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+    AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
+
     FOREACH_SERIE(serie, dataset) {
         int shift;
 
@@ -49,9 +52,9 @@ void GanttRenderer::Draw(wxDC &dc, wxRect rc, DateAxis *horizAxis, CategoryAxis
             double dend = dateCount * (double) (end - minDate) / (double) (maxDate - minDate);
 
             wxRect rcTask;
-            rcTask.x = horizAxis->ToGraphics(dc, rc.x, rc.width, dstart);
-            rcTask.width = horizAxis->ToGraphics(dc, rc.x, rc.width, dend) - rcTask.x;
-            rcTask.y = vertAxis->ToGraphics(dc, rc.y, rc.height, n) + shift;
+            rcTask.x = horizTransform.ToGraphics(dstart);
+            rcTask.width = horizTransform.ToGraphics(dend) - rcTask.x;
+            rcTask.y = vertTransform.ToGraphics(n) + shift;
             rcTask.height = m_barWidth;
 
             serieDraw->Draw(dc, rcTask);
@@ -64,7 +67,7 @@ AreaDraw *GanttRenderer::GetSerieDraw(size_t serie)
     AreaDraw *serieDraw = m_serieDraws.GetAreaDraw(serie);
     if (serieDraw == NULL) {
         serieDraw = new FillAreaDraw(*wxBLACK_PEN,
-                *wxTheBrushList->FindOrCreateBrush(GetDefaultColour(serie), wxBRUSHSTYLE_SOLID));
+                *DrawResources::FindOrCreateBrush(GetDefaultColour(serie), wxBRUSHSTYLE_SOLID));
         m_serieDraws.SetAreaDraw(serie, serieDraw);
     }
     return serieDraw;
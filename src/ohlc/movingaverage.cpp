@@ -18,6 +18,8 @@ MovingAverage::MovingAverage(OHLCDataset *ohlcDataset, int period)
 
     m_ohlcDataset->AddRef();
     m_ohlcDataset->AddObserver(this);
+
+    CalcAverages();
 }
 
 MovingAverage::~MovingAverage()
@@ -33,11 +35,7 @@ size_t MovingAverage::GetSerieCount()
 
 size_t MovingAverage::GetCount(size_t WXUNUSED(serie))
 {
-    int count = m_ohlcDataset->GetCount() - m_period + 1;
-    if (count < 0) {
-        count = 0; // period is larger than OHLC data
-    }
-    return count;
+    return m_averages.size();
 }
 
 wxString MovingAverage::GetSerieName(size_t WXUNUSED(serie))
@@ -52,19 +50,80 @@ double MovingAverage::GetX(size_t index, size_t WXUNUSED(serie))
 
 double MovingAverage::GetY(size_t index, size_t WXUNUSED(serie))
 {
-    wxCHECK_MSG(m_period != 0, 0, wxT("MovingAverage::GetX"));
+    wxCHECK_MSG(index < m_averages.size(), 0, wxT("MovingAverage::GetY"));
 
-    double sum = 0;
+    return m_averages[index];
+}
+
+void MovingAverage::CalcAverages()
+{
+    if (m_period <= 0) {
+        return ;
+    }
 
-    for (size_t n = index; n < index + m_period; n++) {
-        OHLCItem *item = m_ohlcDataset->GetItem(n);
+    size_t period = m_period;
+    size_t itemCount = m_ohlcDataset->GetCount();
+    if (itemCount < period) {
+        return ; // period is larger than OHLC data
+    }
+
+    size_t first = m_averages.size();
+    size_t count = itemCount - period + 1;
+    if (first >= count) {
+        return ;
+    }
+
+    // running sum of closes in window [index, index + period)
+    double sum = 0;
+    for (size_t n = first; n < first + period; n++) {
+        sum += m_ohlcDataset->GetItem(n)->close;
+    }
 
-        sum += item->close;
+    for (size_t index = first; index < count; index++) {
+        if (index != first) {
+            sum += m_ohlcDataset->GetItem(index + period - 1)->close;
+            sum -= m_ohlcDataset->GetItem(index - 1)->close;
+        }
+        m_averages.push_back(sum / period);
     }
-    return sum / m_period;
 }
 
-void MovingAverage::DatasetChanged(Dataset *WXUNUSED(dataset))
+void MovingAverage::DatasetChanged(Dataset *dataset)
 {
-    Dataset::DatasetChanged();
+    DatasetChanged(dataset, DatasetChange());
+}
+
+void MovingAverage::DatasetChanged(Dataset *WXUNUSED(dataset), const DatasetChange &change)
+{
+    if (!change.IsValuesChanged()) {
+        return ; // averages are same
+    }
+
+    size_t oldCount = m_averages.size();
+
+    // averages, that use only items before first changed item, are kept
+    size_t keep = 0;
+    if (change.GetKind() == DATASET_CHANGE_APPEND || change.GetKind() == DATASET_CHANGE_UPDATE) {
+        if (change.GetFirst() + 1 > (size_t) m_period) {
+            keep = wxMin(oldCount, change.GetFirst() + 1 - m_period);
+        }
+    }
+    m_averages.resize(keep);
+
+    CalcAverages();
+
+    size_t count = m_averages.size();
+    if (change.GetKind() == DATASET_CHANGE_APPEND && keep == oldCount) {
+        for (size_t n = oldCount; n < count; n++) {
+            ExtendBounds(BOUNDS_X, GetX(n, 0));
+            ExtendBounds(BOUNDS_Y, m_averages[n]);
+        }
+        Dataset::DatasetChanged(DatasetChange(DATASET_CHANGE_APPEND, 0, oldCount, count - oldCount), false);
+    }
+    else if (change.GetKind() == DATASET_CHANGE_UPDATE && count == oldCount) {
+        Dataset::DatasetChanged(DatasetChange(DATASET_CHANGE_UPDATE, 0, keep, count - keep));
+    }
+    else {
+        Dataset::DatasetChanged();
+    }
 }
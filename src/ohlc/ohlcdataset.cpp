@@ -27,32 +27,43 @@ bool OHLCDataset::AcceptRenderer(Renderer *renderer)
 
 double OHLCDataset::GetMaxValue(bool WXUNUSED(unused))
 {
-    double maxValue = 0;
+    double minValue, maxValue;
 
-    for (size_t n = 0; n < GetCount(); n++) {
-        OHLCItem *item = GetItem(n);
-
-        if (n == 0)
-            maxValue = item->high;
-        else
-            maxValue = wxMax(maxValue, item->high);
+    if (!GetBounds(BOUNDS_Y, minValue, maxValue)) {
+        return 0;
     }
     return maxValue;
 }
 
 double OHLCDataset::GetMinValue(bool WXUNUSED(unused))
 {
-    double minValue = 0;
+    double minValue, maxValue;
+
+    if (!GetBounds(BOUNDS_Y, minValue, maxValue)) {
+        return 0;
+    }
+    return minValue;
+}
+
+bool OHLCDataset::CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue)
+{
+    if (dim != BOUNDS_Y || GetCount() == 0) {
+        return false;
+    }
 
     for (size_t n = 0; n < GetCount(); n++) {
         OHLCItem *item = GetItem(n);
 
-        if (n == 0)
+        if (n == 0) {
             minValue = item->low;
-        else
+            maxValue = item->high;
+        }
+        else {
             minValue = wxMin(minValue, item->low);
+            maxValue = wxMax(maxValue, item->high);
+        }
     }
-    return minValue;
+    return true;
 }
 
 
@@ -0,0 +1,68 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    ohlcexternaldataset.cpp
+// Purpose: OHLC dataset over caller owned records implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/ohlc/ohlcexternaldataset.h>
+
+IMPLEMENT_CLASS(OHLCExternalDataset, OHLCDataset)
+
+OHLCExternalDataset::OHLCExternalDataset(ExternalBuffer *buffer,
+        const ExternalField &open, const ExternalField &high,
+        const ExternalField &low, const ExternalField &close,
+        const ExternalField &volume, const ExternalField &date)
+: m_open(open), m_high(high), m_low(low), m_close(close), m_volume(volume), m_date(date)
+{
+    wxASSERT_MSG(buffer != NULL, wxT("OHLCExternalDataset: buffer is NULL"));
+
+    m_buffer = buffer;
+    memset(&m_item, 0, sizeof(m_item));
+}
+
+OHLCExternalDataset::~OHLCExternalDataset()
+{
+    wxDELETE(m_buffer);
+}
+
+void OHLCExternalDataset::RecordsAppended(size_t count)
+{
+    if (count == 0) {
+        return ;
+    }
+
+    size_t first = m_buffer->GetCount();
+    m_buffer->SetCount(first + count);
+
+    for (size_t n = first; n < first + count; n++) {
+        ExtendBounds(BOUNDS_Y, m_buffer->GetValue(n, m_low));
+        ExtendBounds(BOUNDS_Y, m_buffer->GetValue(n, m_high));
+    }
+    DatasetChanged(DatasetChange(DATASET_CHANGE_APPEND, 0, first, count), false);
+}
+
+OHLCItem *OHLCExternalDataset::GetItem(size_t index)
+{
+    wxCHECK_MSG(index < m_buffer->GetCount(), NULL, wxT("GetItem"));
+
+    m_item.open = m_buffer->GetValue(index, m_open);
+    m_item.high = m_buffer->GetValue(index, m_high);
+    m_item.low = m_buffer->GetValue(index, m_low);
+    m_item.close = m_buffer->GetValue(index, m_close);
+    m_item.volume = (int) m_buffer->GetValue(index, m_volume);
+    m_item.date = (time_t) m_buffer->GetValue(index, m_date);
+    return &m_item;
+}
+
+size_t OHLCExternalDataset::GetCount()
+{
+    return m_buffer->GetCount();
+}
+
+time_t OHLCExternalDataset::GetDate(size_t index)
+{
+    return (time_t) m_buffer->GetValue(index, m_date);
+}
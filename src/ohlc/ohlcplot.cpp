@@ -38,20 +38,16 @@ bool OHLCPlot::AcceptDataset(Dataset *dataset)
             wxDynamicCast(dataset, XYDataset) != NULL);
 }
 
-void OHLCPlot::DrawDatasets(wxDC &dc, wxRect rc)
+void OHLCPlot::DrawDataset(wxDC &dc, wxRect rc, Dataset *dataset)
 {
-    for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
-        Dataset *dataset = GetDataset(nData);
-
-        OHLCDataset *ohlcDataset = wxDynamicCast(dataset, OHLCDataset);
-        if (ohlcDataset != NULL) {
-            DrawOHLCDataset(dc, rc, ohlcDataset);
-        }
-        else {
-            XYDataset *xyDataset = wxDynamicCast(dataset, XYDataset);
-            if (xyDataset != NULL) {
-                DrawXYDataset(dc, rc, xyDataset);
-            }
+    OHLCDataset *ohlcDataset = wxDynamicCast(dataset, OHLCDataset);
+    if (ohlcDataset != NULL) {
+        DrawOHLCDataset(dc, rc, ohlcDataset);
+    }
+    else {
+        XYDataset *xyDataset = wxDynamicCast(dataset, XYDataset);
+        if (xyDataset != NULL) {
+            DrawXYDataset(dc, rc, xyDataset);
         }
     }
 }
@@ -67,16 +63,19 @@ void OHLCPlot::DrawOHLCDataset(wxDC &dc, wxRect rc, OHLCDataset *dataset)
     wxCHECK_RET(vertAxis != NULL, wxT("no axis for data"));
     wxCHECK_RET(horizAxis != NULL, wxT("no axis for data"));
 
+    AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+    AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
+
     // draw OHLC items
     for (size_t n = 0; n < dataset->GetCount(); n++) {
         OHLCItem *item = dataset->GetItem(n);
 
-        wxCoord open = vertAxis->ToGraphics(dc, rc.y, rc.height, item->open);
-        wxCoord high = vertAxis->ToGraphics(dc, rc.y, rc.height, item->high);
-        wxCoord low = vertAxis->ToGraphics(dc, rc.y, rc.height, item->low);
-        wxCoord close = vertAxis->ToGraphics(dc, rc.y, rc.height, item->close);
+        wxCoord open = vertTransform.ToGraphics(item->open);
+        wxCoord high = vertTransform.ToGraphics(item->high);
+        wxCoord low = vertTransform.ToGraphics(item->low);
+        wxCoord close = vertTransform.ToGraphics(item->close);
 
-        wxCoord x = horizAxis->ToGraphics(dc, rc.x, rc.width, n);//item->date);
+        wxCoord x = horizTransform.ToGraphics(n);//item->date);
 
         renderer->DrawItem(dc, x, open, high, low, close);
     }
@@ -200,7 +200,7 @@ void PiePlot::DrawData(ChartDC& cdc, wxRect rc)
 
         double angle2 = 360 * part;
 
-        dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(m_colorScheme.GetColor(n)));
+        dc.SetBrush(*DrawResources::FindOrCreateBrush(m_colorScheme.GetColor(n)));
 
         dc.DrawEllipticArc(x0, y0, radHoriz, radVert, angle1, angle2);
     }
@@ -244,7 +244,7 @@ void PiePlot::DrawData(ChartDC& cdc, wxRect rc)
 
                 EllipticEgde(x0, y0, radHoriz, radVert, a, x1, y1);
 
-                dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(m_colorScheme.GetColor(n)));
+                dc.SetBrush(*DrawResources::FindOrCreateBrush(m_colorScheme.GetColor(n)));
                 dc.FloodFill(x1, y1 + shift3D / 2, m_outlinePen.GetColour(), wxFLOOD_BORDER);
             }
         }
@@ -66,6 +66,16 @@ wxChartPanel *Plot::GetChartPanel()
     return m_chartPanel;
 }
 
+bool Plot::CheckBackgroundChanged()
+{
+    return true;
+}
+
+void Plot::InvalidateBackground()
+{
+    // default - do nothing
+}
+
 void Plot::ChartPanelChanged(wxChartPanel *WXUNUSED(oldPanel), wxChartPanel *WXUNUSED(newPanel))
 {
     // default - do nothing
@@ -17,6 +17,16 @@ Symbol::~Symbol()
 {
 }
 
+bool Symbol::CanRasterize()
+{
+    return false;
+}
+
+void Symbol::Rasterize(ChartRaster &WXUNUSED(raster), wxCoord WXUNUSED(x), wxCoord WXUNUSED(y))
+{
+    // default - do nothing
+}
+
 MaskedSymbol::MaskedSymbol(const char **maskData, wxCoord size)
 {
     m_maskBmp = wxBitmap(maskData);
@@ -74,12 +84,22 @@ CircleSymbol::~CircleSymbol()
 
 void CircleSymbol::Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color)
 {
-    dc.SetPen(*wxThePenList->FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
-    dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(color));
+    dc.SetPen(*DrawResources::FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
+    dc.SetBrush(*DrawResources::FindOrCreateBrush(color));
 
     dc.DrawCircle(x, y, m_size / 2);
 }
 
+bool CircleSymbol::CanRasterize()
+{
+    return true;
+}
+
+void CircleSymbol::Rasterize(ChartRaster &raster, wxCoord x, wxCoord y)
+{
+    raster.FillCircle(x, y, m_size / 2);
+}
+
 
 SquareSymbol::SquareSymbol(wxCoord size)
 : ShapeSymbol(size)
@@ -92,12 +112,22 @@ SquareSymbol::~SquareSymbol()
 
 void SquareSymbol::Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color)
 {
-    dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(color));
-    dc.SetPen(*wxThePenList->FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
+    dc.SetBrush(*DrawResources::FindOrCreateBrush(color));
+    dc.SetPen(*DrawResources::FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
 
     dc.DrawRectangle(x - m_size / 2, y - m_size / 2, m_size, m_size);
 }
 
+bool SquareSymbol::CanRasterize()
+{
+    return true;
+}
+
+void SquareSymbol::Rasterize(ChartRaster &raster, wxCoord x, wxCoord y)
+{
+    raster.FillRectangle(x - m_size / 2, y - m_size / 2, m_size, m_size);
+}
+
 CrossSymbol::CrossSymbol(wxCoord size)
 : ShapeSymbol(size)
 {
@@ -109,12 +139,24 @@ CrossSymbol::~CrossSymbol()
 
 void CrossSymbol::Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color)
 {
-    dc.SetPen(*wxThePenList->FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
+    dc.SetPen(*DrawResources::FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
 
     dc.DrawLine(x - m_size / 2, y, x + m_size / 2, y);
     dc.DrawLine(x, y - m_size / 2, x, y + m_size / 2);
 }
 
+bool CrossSymbol::CanRasterize()
+{
+    return true;
+}
+
+void CrossSymbol::Rasterize(ChartRaster &raster, wxCoord x, wxCoord y)
+{
+    // wxDC::DrawLine excludes end point
+    raster.DrawLine(x - m_size / 2, y, x + m_size / 2 - 1, y);
+    raster.DrawLine(x, y - m_size / 2, x, y + m_size / 2 - 1);
+}
+
 TriangleSymbol::TriangleSymbol(wxCoord size)
 : ShapeSymbol(size)
 {
@@ -126,8 +168,8 @@ TriangleSymbol::~TriangleSymbol()
 
 void TriangleSymbol::Draw(wxDC &dc, wxCoord x, wxCoord y, wxColour color)
 {
-    dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(color));
-    dc.SetPen(*wxThePenList->FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
+    dc.SetBrush(*DrawResources::FindOrCreateBrush(color));
+    dc.SetPen(*DrawResources::FindOrCreatePen(color, 1, wxPENSTYLE_SOLID));
 
     const double COS_30 = 0.866158094;
     const double SIN_30 = 0.5;
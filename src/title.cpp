@@ -71,12 +71,14 @@ wxSize TextElement::CalculateExtent(wxDC& dc)
 TextElementContainer::TextElementContainer()
 : m_extent()
 , m_margin(40)
+, m_extentValid(false)
 {
 }
 
 TextElementContainer::TextElementContainer(const TextElement& element)
 : m_extent()
 , m_margin(40)
+, m_extentValid(false)
 {
     m_elements.push_back(element);
 }
@@ -84,6 +86,7 @@ TextElementContainer::TextElementContainer(const TextElement& element)
 TextElementContainer::TextElementContainer(const wxString& contents)
 : m_extent()
 , m_margin(40)
+, m_extentValid(false)
 {
     m_elements.push_back(TextElement(contents, wxALIGN_CENTER_HORIZONTAL));
 }
@@ -95,6 +98,7 @@ TextElementContainer::~TextElementContainer()
 void TextElementContainer::AddElement(TextElement element)
 {
     m_elements.push_back(element);
+    m_extentValid = false;
 }
 
 bool TextElementContainer::IsEmpty() const
@@ -113,6 +117,11 @@ void TextElementContainer::Draw(wxDC& dc, wxRect rc)
 
 wxSize TextElementContainer::CalculateExtent(wxDC& dc)
 {
+    TextMeasureKey extentKey(dc);
+    if (m_extentValid && extentKey == m_extentKey) {
+        return m_extent;
+    }
+
     wxSize extent(0, 0);
     for(size_t i = 0; i < m_elements.size(); ++i) {
         TextElement& element = m_elements[i];
@@ -120,6 +129,9 @@ wxSize TextElementContainer::CalculateExtent(wxDC& dc)
         extent.y = wxMax(extent.y, boxSize.y);
     }
 
+    m_extent = extent;
+    m_extentValid = true;
+    m_extentKey = extentKey;
     return extent;
 }
 
@@ -44,6 +44,20 @@ double JulianTimeSeriesDataset::GetY(size_t index, size_t WXUNUSED(serie))
     return m_data[index].second;
 }
 
+void JulianTimeSeriesDataset::GetXYBlock(size_t WXUNUSED(serie), size_t first, size_t count, double *xs, double *ys)
+{
+    for (size_t n = 0; n < count; n++) {
+        const TimePair &tv = m_data[first + n];
+
+        if (xs != NULL) {
+            xs[n] = tv.first;
+        }
+        if (ys != NULL) {
+            ys[n] = tv.second;
+        }
+    }
+}
+
 void JulianTimeSeriesDataset::clear()
 {
    m_data.clear();
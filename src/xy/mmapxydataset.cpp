@@ -0,0 +1,426 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    mmapxydataset.cpp
+// Purpose: memory mapped xy dataset implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/xy/mmapxydataset.h>
+#include <wx/file.h>
+#include <wx/vector.h>
+
+#ifdef __WINDOWS__
+#include <wx/msw/wrapwin.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#define MMAPXY_MAGIC "WXFCXYD"
+#define MMAPXY_VERSION 1
+#define MMAPXY_FLAG_XSORTED 0x1
+#define MMAPXY_NAME_SIZE 32
+
+// dataset is read by blocks of this size, when writing file
+#define MMAPXY_WRITE_BLOCK 65536
+
+struct MmapXYHeader
+{
+    char magic[8];
+    wxUint32 version;
+    wxUint32 serieCount;
+};
+
+struct MmapXYSerieEntry
+{
+    wxUint64 count;
+    wxUint64 xOffset;
+    wxUint64 yOffset;
+    double xMin;
+    double xMax;
+    double yMin;
+    double yMax;
+    wxUint32 flags;
+    wxUint32 reserved;
+    char name[MMAPXY_NAME_SIZE];
+};
+
+IMPLEMENT_CLASS(MmapXYDataset, XYDataset)
+
+MmapXYDataset::MmapXYDataset()
+{
+    m_data = NULL;
+    m_size = 0;
+    m_serieCount = 0;
+#ifdef __WINDOWS__
+    m_file = NULL;
+    m_mapping = NULL;
+#endif
+}
+
+MmapXYDataset::MmapXYDataset(const wxString &filename)
+{
+    m_data = NULL;
+    m_size = 0;
+    m_serieCount = 0;
+#ifdef __WINDOWS__
+    m_file = NULL;
+    m_mapping = NULL;
+#endif
+
+    Open(filename);
+}
+
+MmapXYDataset::~MmapXYDataset()
+{
+    Unmap();
+}
+
+bool MmapXYDataset::Open(const wxString &filename)
+{
+    Unmap();
+
+    if (!Map(filename)) {
+        wxLogError(wxT("MmapXYDataset::Open: cannot map file %s"), filename.c_str());
+        Unmap();
+    }
+    else if (!CheckLayout()) {
+        wxLogError(wxT("MmapXYDataset::Open: invalid file layout %s"), filename.c_str());
+        Unmap();
+    }
+
+    DatasetChanged();
+    return IsOk();
+}
+
+void MmapXYDataset::Close()
+{
+    if (IsOk()) {
+        Unmap();
+        DatasetChanged();
+    }
+}
+
+bool MmapXYDataset::Map(const wxString &filename)
+{
+#ifdef __WINDOWS__
+    HANDLE file = ::CreateFile(filename.t_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    m_file = file;
+
+    LARGE_INTEGER size;
+    if (!::GetFileSizeEx(file, &size) || size.QuadPart == 0
+            || (wxUint64) size.QuadPart > (wxUint64) (size_t) -1) {
+        return false;
+    }
+
+    HANDLE mapping = ::CreateFileMapping(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        return false;
+    }
+    m_mapping = mapping;
+
+    void *data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL) {
+        return false;
+    }
+
+    m_data = (const char *) data;
+    m_size = (size_t) size.QuadPart;
+    return true;
+#else
+    int fd = ::open(filename.fn_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size <= 0
+            || (wxUint64) st.st_size > (wxUint64) (size_t) -1) {
+        ::close(fd);
+        return false;
+    }
+
+    void *data = ::mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    // mapping holds its own reference to file
+    ::close(fd);
+
+    if (data == MAP_FAILED) {
+        return false;
+    }
+
+    m_data = (const char *) data;
+    m_size = (size_t) st.st_size;
+    return true;
+#endif
+}
+
+void MmapXYDataset::Unmap()
+{
+#ifdef __WINDOWS__
+    if (m_data != NULL) {
+        ::UnmapViewOfFile(m_data);
+    }
+    if (m_mapping != NULL) {
+        ::CloseHandle((HANDLE) m_mapping);
+        m_mapping = NULL;
+    }
+    if (m_file != NULL) {
+        ::CloseHandle((HANDLE) m_file);
+        m_file = NULL;
+    }
+#else
+    if (m_data != NULL) {
+        ::munmap((void *) m_data, m_size);
+    }
+#endif
+
+    m_data = NULL;
+    m_size = 0;
+    m_serieCount = 0;
+}
+
+bool MmapXYDataset::CheckLayout()
+{
+    if (m_size < sizeof(MmapXYHeader)) {
+        return false;
+    }
+
+    const MmapXYHeader *header = (const MmapXYHeader *) m_data;
+    if (memcmp(header->magic, MMAPXY_MAGIC, sizeof(header->magic)) != 0
+            || header->version != MMAPXY_VERSION) {
+        return false;
+    }
+
+    wxUint64 tableSize = (wxUint64) header->serieCount * sizeof(MmapXYSerieEntry);
+    if (tableSize > m_size - sizeof(MmapXYHeader)) {
+        return false;
+    }
+
+    m_serieCount = header->serieCount;
+
+    // columns must lie inside file and be aligned, to be accessed as double arrays
+    for (size_t serie = 0; serie < m_serieCount; serie++) {
+        const MmapXYSerieEntry *entry = GetEntry(serie);
+
+        if (entry->count > m_size / sizeof(double)) {
+            return false;
+        }
+
+        wxUint64 columnSize = entry->count * sizeof(double);
+        wxUint64 offsets[] = { entry->xOffset, entry->yOffset };
+
+        for (size_t n = 0; n < WXSIZEOF(offsets); n++) {
+            if (offsets[n] % sizeof(double) != 0
+                    || offsets[n] > m_size || columnSize > m_size - offsets[n]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+const MmapXYSerieEntry *MmapXYDataset::GetEntry(size_t serie) const
+{
+    return ((const MmapXYSerieEntry *) (m_data + sizeof(MmapXYHeader))) + serie;
+}
+
+bool MmapXYDataset::Write(const wxString &filename, XYDataset *dataset)
+{
+    wxCHECK(dataset != NULL, false);
+
+    size_t serieCount = dataset->GetSerieCount();
+    wxVector<MmapXYSerieEntry> entries(serieCount);
+    wxVector<double> xs;
+    wxVector<double> ys;
+
+    // first pass: layout, bounds and x order of every serie
+    wxUint64 offset = sizeof(MmapXYHeader) + serieCount * sizeof(MmapXYSerieEntry);
+
+    for (size_t serie = 0; serie < serieCount; serie++) {
+        MmapXYSerieEntry &entry = entries[serie];
+        memset(&entry, 0, sizeof(entry));
+
+        size_t count = dataset->GetCount(serie);
+
+        entry.count = count;
+        entry.xOffset = offset;
+        entry.yOffset = offset + count * sizeof(double);
+        entry.flags = MMAPXY_FLAG_XSORTED;
+        offset = entry.yOffset + count * sizeof(double);
+
+        wxCharBuffer name = dataset->GetSerieName(serie).ToUTF8();
+        strncpy(entry.name, name.data(), MMAPXY_NAME_SIZE - 1);
+
+        for (size_t first = 0; first < count; first += MMAPXY_WRITE_BLOCK) {
+            size_t n = wxMin(count - first, (size_t) MMAPXY_WRITE_BLOCK);
+
+            xs.resize(n);
+            ys.resize(n);
+            dataset->GetXYBlock(serie, first, n, &xs[0], &ys[0]);
+
+            for (size_t i = 0; i < n; i++) {
+                if (first == 0 && i == 0) {
+                    entry.xMin = entry.xMax = xs[0];
+                    entry.yMin = entry.yMax = ys[0];
+                    continue;
+                }
+
+                if (xs[i] < entry.xMax) {
+                    entry.flags &= ~MMAPXY_FLAG_XSORTED;
+                }
+                entry.xMin = wxMin(entry.xMin, xs[i]);
+                entry.xMax = wxMax(entry.xMax, xs[i]);
+                entry.yMin = wxMin(entry.yMin, ys[i]);
+                entry.yMax = wxMax(entry.yMax, ys[i]);
+            }
+        }
+    }
+
+    wxFile file;
+    if (!file.Create(filename, true)) {
+        return false;
+    }
+
+    MmapXYHeader header;
+    memcpy(header.magic, MMAPXY_MAGIC, sizeof(header.magic));
+    header.version = MMAPXY_VERSION;
+    header.serieCount = (wxUint32) serieCount;
+
+    if (file.Write(&header, sizeof(header)) != sizeof(header)) {
+        return false;
+    }
+    if (serieCount != 0) {
+        size_t tableSize = serieCount * sizeof(MmapXYSerieEntry);
+        if (file.Write(&entries[0], tableSize) != tableSize) {
+            return false;
+        }
+    }
+
+    // second pass: column blocks, x column followed by y column
+    for (size_t serie = 0; serie < serieCount; serie++) {
+        size_t count = (size_t) entries[serie].count;
+
+        for (int column = 0; column < 2; column++) {
+            for (size_t first = 0; first < count; first += MMAPXY_WRITE_BLOCK) {
+                size_t n = wxMin(count - first, (size_t) MMAPXY_WRITE_BLOCK);
+
+                xs.resize(n);
+                dataset->GetXYBlock(serie, first, n,
+                        (column == 0) ? &xs[0] : NULL, (column == 1) ? &xs[0] : NULL);
+
+                if (file.Write(&xs[0], n * sizeof(double)) != n * sizeof(double)) {
+                    return false;
+                }
+            }
+        }
+    }
+    return file.Close();
+}
+
+size_t MmapXYDataset::GetSerieCount()
+{
+    return m_serieCount;
+}
+
+wxString MmapXYDataset::GetSerieName(size_t serie)
+{
+    wxCHECK(serie < m_serieCount, wxEmptyString);
+
+    const char *name = GetEntry(serie)->name;
+    size_t len = 0;
+    while (len < MMAPXY_NAME_SIZE && name[len] != 0) {
+        len++;
+    }
+    return wxString::FromUTF8(name, len);
+}
+
+size_t MmapXYDataset::GetCount(size_t serie)
+{
+    wxCHECK(serie < m_serieCount, 0);
+    return (size_t) GetEntry(serie)->count;
+}
+
+double MmapXYDataset::GetX(size_t index, size_t serie)
+{
+    wxCHECK(serie < m_serieCount, 0);
+    return GetXColumn(serie)[index];
+}
+
+double MmapXYDataset::GetY(size_t index, size_t serie)
+{
+    wxCHECK(serie < m_serieCount, 0);
+    return GetYColumn(serie)[index];
+}
+
+void MmapXYDataset::GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys)
+{
+    wxCHECK_RET(serie < m_serieCount, wxT("MmapXYDataset::GetXYBlock"));
+    wxCHECK_RET(first + count <= GetEntry(serie)->count, wxT("MmapXYDataset::GetXYBlock"));
+
+    if (count == 0) {
+        return ;
+    }
+    if (xs != NULL) {
+        memcpy(xs, GetXColumn(serie) + first, count * sizeof(double));
+    }
+    if (ys != NULL) {
+        memcpy(ys, GetYColumn(serie) + first, count * sizeof(double));
+    }
+}
+
+const double *MmapXYDataset::GetXColumn(size_t serie)
+{
+    wxCHECK(serie < m_serieCount, NULL);
+    return (const double *) (m_data + GetEntry(serie)->xOffset);
+}
+
+const double *MmapXYDataset::GetYColumn(size_t serie)
+{
+    wxCHECK(serie < m_serieCount, NULL);
+    return (const double *) (m_data + GetEntry(serie)->yOffset);
+}
+
+bool MmapXYDataset::IsXSorted(size_t serie)
+{
+    wxCHECK(serie < m_serieCount, false);
+    return (GetEntry(serie)->flags & MMAPXY_FLAG_XSORTED) != 0;
+}
+
+bool MmapXYDataset::CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue)
+{
+    if (dim != BOUNDS_X && dim != BOUNDS_Y) {
+        return false;
+    }
+
+    // bounds are taken from serie table, columns are not touched
+    bool hasValues = false;
+
+    for (size_t serie = 0; serie < m_serieCount; serie++) {
+        const MmapXYSerieEntry *entry = GetEntry(serie);
+        if (entry->count == 0) {
+            continue;
+        }
+
+        double serieMin = (dim == BOUNDS_X) ? entry->xMin : entry->yMin;
+        double serieMax = (dim == BOUNDS_X) ? entry->xMax : entry->yMax;
+
+        if (!hasValues) {
+            minValue = serieMin;
+            maxValue = serieMax;
+            hasValues = true;
+        }
+        else {
+            minValue = wxMin(minValue, serieMin);
+            maxValue = wxMax(maxValue, serieMax);
+        }
+    }
+    return hasValues;
+}
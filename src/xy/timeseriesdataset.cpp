@@ -22,6 +22,7 @@ TimeSeriesDataset::TimeSeriesDataset(double *data, time_t *times, size_t count)
         m_data[n] = data[n];
         m_times[n] = times[n];
     }
+    SetXSorted(true); // x values are indexes
 }
 
 TimeSeriesDataset::~TimeSeriesDataset()
@@ -61,6 +62,11 @@ double TimeSeriesDataset::GetY(size_t index, size_t WXUNUSED(serie))
     return m_data[index];
 }
 
+const double *TimeSeriesDataset::GetYColumn(size_t WXUNUSED(serie))
+{
+    return m_data;
+}
+
 time_t TimeSeriesDataset::GetDate(size_t index)
 {
     return m_times[index];
@@ -16,6 +16,7 @@ WX_DEFINE_EXPORTED_OBJARRAY(wxDoubleArray);
 
 VectorDataset::VectorDataset()
 {
+    SetXSorted(true); // x values are indexes
 }
 
 VectorDataset::~VectorDataset()
@@ -25,31 +26,41 @@ VectorDataset::~VectorDataset()
 void VectorDataset::Add(double y)
 {
     m_values.Add(y);
-    DatasetChanged();
+
+    ExtendBounds(BOUNDS_X, m_values.Count());
+    ExtendBounds(BOUNDS_Y, y);
+    DatasetChanged(DatasetChange(DATASET_CHANGE_APPEND, 0, m_values.Count() - 1, 1), false);
 }
 
 void VectorDataset::Replace(size_t index, double y)
 {
     if (index < m_values.Count()) {
+        ValueRemoved(BOUNDS_Y, m_values[index]);
         m_values[index] = y;
+        ExtendBounds(BOUNDS_Y, y);
+        InvalidateRangeIndex(0, index);
 
-        DatasetChanged();
+        DatasetChanged(DatasetChange(DATASET_CHANGE_UPDATE, 0, index, 1), false);
     }
 }
 
 void VectorDataset::RemoveAt(size_t index)
 {
     if (index < m_values.Count()) {
+        ValueRemoved(BOUNDS_Y, m_values[index]);
         m_values.RemoveAt(index);
 
-        DatasetChanged();
+        // x values are indexes, so removal always shrinks x range
+        InvalidateBounds(BOUNDS_X);
+        InvalidateRangeIndex(0, index);
+        DatasetChanged(DatasetChange(DATASET_CHANGE_REMOVE, 0, index, 1), false);
     }
 }
 
 void VectorDataset::Clear()
 {
     m_values.Clear();
-    DatasetChanged();
+    DatasetChanged(DatasetChange(DATASET_CHANGE_CLEAR, 0));
 }
 
 double VectorDataset::GetX(size_t index, size_t WXUNUSED(serie))
@@ -62,6 +73,20 @@ double VectorDataset::GetY(size_t index, size_t WXUNUSED(serie))
     return m_values[index];
 }
 
+void VectorDataset::GetXYBlock(size_t WXUNUSED(serie), size_t first, size_t count, double *xs, double *ys)
+{
+    wxCHECK_RET(first + count <= m_values.Count(), wxT("VectorDataset::GetXYBlock"));
+
+    for (size_t n = 0; n < count; n++) {
+        if (xs != NULL) {
+            xs[n] = first + n + 1;
+        }
+        if (ys != NULL) {
+            ys[n] = m_values[first + n];
+        }
+    }
+}
+
 size_t VectorDataset::GetCount(size_t WXUNUSED(serie))
 {
     return m_values.Count();
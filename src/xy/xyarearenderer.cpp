@@ -19,10 +19,19 @@ XYAreaRenderer::XYAreaRenderer(const wxPen& outlinePen, const wxBrush& areaBrush
     : m_outlinePen(outlinePen)
     , m_areaBrush(areaBrush)
     , m_fillZero(false)
+    , m_decimation(false)
 {
     
 }
 
+void XYAreaRenderer::SetDecimation(bool decimation)
+{
+    if (m_decimation != decimation) {
+        m_decimation = decimation;
+        FireNeedRedraw();
+    }
+}
+
 XYAreaRenderer::~XYAreaRenderer()
 {
 }
@@ -56,7 +65,7 @@ void XYAreaRenderer::Draw(wxDC &dc, wxRect rcData, wxCoord x0, wxCoord y0, wxCoo
 //void XYAreaRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 //{
 //    FOREACH_SERIE(serie, dataset) {
-//        dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(GetSerieColour(serie)));
+//        dc.SetBrush(*DrawResources::FindOrCreateBrush(GetSerieColour(serie)));
 //
 //        for (size_t n = 0; n < dataset->GetCount(serie) - 1; n++) {
 //            double x0 = dataset->GetX(n, serie);
@@ -91,38 +100,49 @@ void XYAreaRenderer::Draw(wxDC &dc, wxRect rcData, wxCoord x0, wxCoord y0, wxCoo
 
 void XYAreaRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
+    XYDataBlock block;
+    XYLinePoints linePoints(m_decimation);
+
+    AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+    AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
+
     FOREACH_SERIE(serie, dataset) {
-        dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(GetSerieColour(serie)));
-        dc.SetBrush(*wxTheBrushList->FindOrCreateBrush(GetSerieColour(serie)));
-        size_t sz = dataset->GetCount(serie);
+        dc.SetBrush(*DrawResources::FindOrCreateBrush(GetSerieColour(serie)));
+        dc.SetBrush(*DrawResources::FindOrCreateBrush(GetSerieColour(serie)));
+
+        // take one point beyond visible range on each side,
+        // so area is continued to plot edges
+        size_t first, count;
+        if (!GetVisibleRange(dc, horizTransform, horizAxis, dataset, serie, first, count, 1)) {
+            continue;
+        }
+
+        block.Load(dataset, serie, first, count);
+        // translate to graphics coordinates.
+        block.ToGraphics(horizTransform, vertTransform);
+        const double *xs = block.GetX();
+        const wxCoord *xgs = block.GetXCoords();
+        const wxCoord *ygs = block.GetYCoords();
+        size_t sz = block.GetCount();
 
-        std::vector<wxPoint> pts;
-        pts.reserve(sz);
+        // decimated line has at most four points per pixel column
+        linePoints.Clear(m_decimation ? wxMin(sz, (size_t) (4 * rc.width + 4)) : sz);
 
         double x_min, x_max;
         horizAxis->GetDataBounds(x_min, x_max);
-        double x0, y0;
 
         for (size_t n = 0; n < sz; n++) {
-            x0 = dataset->GetX(n, serie);
-            y0 = dataset->GetY(n, serie);
-            if (x0 < x_min || x0 > x_max)
+            if (xs[n] < x_min || xs[n] > x_max)
                 continue;
-            // translate to graphics coordinates.
-            wxPoint pt;
-            pt.x = horizAxis->ToGraphics(dc, rc.x, rc.width, x0);
-            pt.y = vertAxis->ToGraphics(dc, rc.y, rc.height, y0);
-            if (pts.empty())
-                pts.push_back(pt);
-            else {
-                if (pts.back() != pt)
-                    pts.push_back(pt);
-            }
+            linePoints.Add(wxPoint(xgs[n], ygs[n]));
         }
 
+        std::vector<wxPoint> &pts = linePoints.GetPoints();
+
         if (!pts.empty()) {
+            wxCoord y0;
             if (m_fillZero) {
-                y0 = vertAxis->ToGraphics(dc, rc.y, rc.height, 0);
+                y0 = vertTransform.ToGraphics(0);
             } else {
                 y0 = rc.y + rc.height;
             }
@@ -134,6 +154,10 @@ void XYAreaRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis,
             pts.push_back(pt);
         }
 
+        if (pts.empty()) {
+            continue;
+        }
+
         dc.SetPen(wxNoPen);
         dc.DrawPolygon(static_cast<int>(pts.size()), &pts[0]);
 
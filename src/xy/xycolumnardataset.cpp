@@ -0,0 +1,403 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xycolumnardataset.cpp
+// Purpose: xy columnar serie and dataset implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/xy/xycolumnardataset.h>
+
+#include <string.h>
+
+IMPLEMENT_CLASS(XYColumnarSerie, wxObject)
+IMPLEMENT_CLASS(XYColumnarDataset, XYDataset)
+
+//
+// XYColumnarSerie
+//
+
+XYColumnarSerie::XYColumnarSerie()
+{
+    m_dataset = NULL;
+    m_visible = true;
+    m_xSorted = 1;
+}
+
+XYColumnarSerie::XYColumnarSerie(const wxVector<double> &xs, const wxVector<double> &ys)
+: m_xs(xs), m_ys(ys)
+{
+    wxASSERT_MSG(xs.size() == ys.size(), wxT("XYColumnarSerie: columns must have same size"));
+
+    m_dataset = NULL;
+    m_visible = true;
+    m_xSorted = -1;
+}
+
+XYColumnarSerie::XYColumnarSerie(const wxVector<wxRealPoint> &data)
+{
+    m_xs.resize(data.size());
+    m_ys.resize(data.size());
+    for (size_t n = 0; n < data.size(); n++) {
+        m_xs[n] = data[n].x;
+        m_ys[n] = data[n].y;
+    }
+
+    m_dataset = NULL;
+    m_visible = true;
+    m_xSorted = -1;
+}
+
+XYColumnarSerie::~XYColumnarSerie()
+{
+}
+
+void XYColumnarSerie::Reserve(size_t count)
+{
+    m_xs.reserve(count);
+    m_ys.reserve(count);
+}
+
+void XYColumnarSerie::Append(double x, double y)
+{
+    m_xs.push_back(x);
+    m_ys.push_back(y);
+
+    PointsAppended(m_xs.size() - 1);
+}
+
+void XYColumnarSerie::Append(const wxRealPoint &pt)
+{
+    Append(pt.x, pt.y);
+}
+
+void XYColumnarSerie::Append(const double *xs, const double *ys, size_t count)
+{
+    if (count == 0) {
+        return ;
+    }
+
+    size_t first = m_xs.size();
+
+    m_xs.insert(m_xs.end(), xs, xs + count);
+    m_ys.insert(m_ys.end(), ys, ys + count);
+
+    PointsAppended(first);
+}
+
+void XYColumnarSerie::Insert(size_t index, double x, double y)
+{
+    wxCHECK_RET(index <= m_xs.size(), wxT("XYColumnarSerie::Insert"));
+
+    if (index == m_xs.size()) {
+        Append(x, y);
+        return ;
+    }
+
+    if (m_xSorted == 1 && (x > m_xs[index] || (index > 0 && x < m_xs[index - 1]))) {
+        m_xSorted = 0;
+    }
+
+    m_xs.insert(m_xs.begin() + index, x);
+    m_ys.insert(m_ys.begin() + index, y);
+
+    if (m_dataset != NULL && m_visible) {
+        size_t serie = m_dataset->GetSerieIndex(this);
+
+        m_dataset->ExtendBounds(BOUNDS_X, x);
+        m_dataset->ExtendBounds(BOUNDS_Y, y);
+        m_dataset->InvalidateRangeIndex(serie, index);
+        m_dataset->DatasetChanged(DatasetChange(DATASET_CHANGE_INSERT, serie, index, 1), false);
+    }
+}
+
+void XYColumnarSerie::Remove(size_t index, size_t count)
+{
+    wxCHECK_RET(index + count <= m_xs.size(), wxT("XYColumnarSerie::Remove"));
+
+    if (count == 0) {
+        return ;
+    }
+
+    if (m_dataset != NULL && m_visible) {
+        // bounds need rescan only if removed point was an extreme
+        for (size_t n = index; n < index + count; n++) {
+            m_dataset->ValueRemoved(BOUNDS_X, m_xs[n]);
+            m_dataset->ValueRemoved(BOUNDS_Y, m_ys[n]);
+        }
+        m_dataset->InvalidateRangeIndex(m_dataset->GetSerieIndex(this), index);
+    }
+
+    // removal keeps order of remaining points
+    m_xs.erase(m_xs.begin() + index, m_xs.begin() + index + count);
+    m_ys.erase(m_ys.begin() + index, m_ys.begin() + index + count);
+
+    if (m_dataset != NULL && m_visible) {
+        m_dataset->DatasetChanged(DatasetChange(DATASET_CHANGE_REMOVE,
+                m_dataset->GetSerieIndex(this), index, count), false);
+    }
+}
+
+void XYColumnarSerie::Shift(double x, double y)
+{
+    if (m_xs.empty()) {
+        Append(x, y);
+        return ;
+    }
+
+    if (m_dataset != NULL && m_visible) {
+        m_dataset->ValueRemoved(BOUNDS_X, m_xs[0]);
+        m_dataset->ValueRemoved(BOUNDS_Y, m_ys[0]);
+    }
+
+    if (m_xSorted == 1 && x < m_xs.back()) {
+        m_xSorted = 0;
+    }
+
+    m_xs.erase(m_xs.begin());
+    m_ys.erase(m_ys.begin());
+    m_xs.push_back(x);
+    m_ys.push_back(y);
+
+    if (m_dataset != NULL && m_visible) {
+        size_t serie = m_dataset->GetSerieIndex(this);
+
+        m_dataset->ExtendBounds(BOUNDS_X, x);
+        m_dataset->ExtendBounds(BOUNDS_Y, y);
+        // all points are moved
+        m_dataset->InvalidateRangeIndex(serie, 0);
+        m_dataset->DatasetChanged(DatasetChange(DATASET_CHANGE_UPDATE, serie, 0, m_xs.size()), false);
+    }
+}
+
+void XYColumnarSerie::Clear()
+{
+    m_xs.clear();
+    m_ys.clear();
+    m_xSorted = 1;
+
+    PointsChanged(0, DATASET_CHANGE_CLEAR);
+}
+
+void XYColumnarSerie::UpdatePoint(size_t index, double x, double y)
+{
+    wxCHECK_RET(index < m_xs.size(), wxT("XYColumnarSerie::UpdatePoint"));
+
+    if (m_dataset != NULL && m_visible) {
+        m_dataset->ValueRemoved(BOUNDS_X, m_xs[index]);
+        m_dataset->ValueRemoved(BOUNDS_Y, m_ys[index]);
+    }
+
+    m_xs[index] = x;
+    m_ys[index] = y;
+
+    if (m_xSorted == 1) {
+        if ((index > 0 && x < m_xs[index - 1])
+                || (index + 1 < m_xs.size() && x > m_xs[index + 1])) {
+            m_xSorted = 0;
+        }
+    }
+    else {
+        m_xSorted = -1;
+    }
+
+    if (m_dataset != NULL && m_visible) {
+        size_t serie = m_dataset->GetSerieIndex(this);
+
+        m_dataset->ExtendBounds(BOUNDS_X, x);
+        m_dataset->ExtendBounds(BOUNDS_Y, y);
+        m_dataset->InvalidateRangeIndex(serie, index);
+        m_dataset->DatasetChanged(DatasetChange(DATASET_CHANGE_UPDATE, serie, index, 1), false);
+    }
+}
+
+void XYColumnarSerie::SetValues(const wxVector<double> &xs, const wxVector<double> &ys)
+{
+    wxCHECK_RET(xs.size() == ys.size(), wxT("XYColumnarSerie::SetValues: columns must have same size"));
+
+    m_xs = xs;
+    m_ys = ys;
+    m_xSorted = -1;
+
+    PointsChanged(0);
+}
+
+void XYColumnarSerie::SetVisible(bool visible)
+{
+    if (m_visible != visible) {
+        m_visible = visible;
+        PointsChanged(0);
+    }
+}
+
+void XYColumnarSerie::SetName(const wxString &name)
+{
+    m_name = name;
+
+    if (m_dataset != NULL) {
+        m_dataset->DatasetChanged(DatasetChange(DATASET_CHANGE_RENAME, m_dataset->GetSerieIndex(this)), false);
+    }
+}
+
+void XYColumnarSerie::PointsAppended(size_t first)
+{
+    size_t count = m_xs.size();
+
+    if (m_xSorted == 1) {
+        for (size_t n = wxMax(first, (size_t) 1); n < count; n++) {
+            if (m_xs[n] < m_xs[n - 1]) {
+                m_xSorted = 0;
+                break;
+            }
+        }
+    }
+
+    if (m_dataset == NULL || !m_visible) {
+        return ;
+    }
+
+    // widen cached bounds with appended points, instead of full rescan
+    for (size_t n = first; n < count; n++) {
+        m_dataset->ExtendBounds(BOUNDS_X, m_xs[n]);
+        m_dataset->ExtendBounds(BOUNDS_Y, m_ys[n]);
+    }
+    m_dataset->DatasetChanged(DatasetChange(DATASET_CHANGE_APPEND,
+            m_dataset->GetSerieIndex(this), first, count - first), false);
+}
+
+void XYColumnarSerie::PointsChanged(size_t first, DATASET_CHANGE_KIND kind)
+{
+    if (m_dataset == NULL) {
+        return ;
+    }
+
+    size_t serie = m_dataset->GetSerieIndex(this);
+
+    m_dataset->InvalidateBounds(BOUNDS_X);
+    m_dataset->InvalidateBounds(BOUNDS_Y);
+    m_dataset->InvalidateRangeIndex(serie, first);
+    m_dataset->DatasetChanged(DatasetChange(kind, serie), false);
+}
+
+//
+// XYColumnarDataset
+//
+
+XYColumnarDataset::XYColumnarDataset()
+{
+}
+
+XYColumnarDataset::~XYColumnarDataset()
+{
+    for (size_t n = 0; n < m_series.size(); n++) {
+        wxDELETE(m_series[n]);
+    }
+}
+
+void XYColumnarDataset::AddSerie(XYColumnarSerie *serie)
+{
+    wxCHECK_RET(serie != NULL && serie->m_dataset == NULL, wxT("XYColumnarDataset::AddSerie"));
+
+    serie->m_dataset = this;
+    m_series.push_back(serie);
+    DatasetChanged();
+}
+
+XYColumnarSerie *XYColumnarDataset::GetSerie(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), NULL);
+    return m_series[serie];
+}
+
+void XYColumnarDataset::SetSerieName(size_t serie, const wxString &name)
+{
+    wxCHECK_RET(serie < m_series.size(), wxT("XYColumnarDataset::SetSerieName"));
+    m_series[serie]->SetName(name);
+}
+
+size_t XYColumnarDataset::GetSerieCount()
+{
+    return m_series.size();
+}
+
+wxString XYColumnarDataset::GetSerieName(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), wxEmptyString);
+    return m_series[serie]->GetName();
+}
+
+size_t XYColumnarDataset::GetCount(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), 0);
+    return m_series[serie]->GetCount();
+}
+
+double XYColumnarDataset::GetX(size_t index, size_t serie)
+{
+    wxCHECK(serie < m_series.size(), 0);
+    return m_series[serie]->GetX(index);
+}
+
+double XYColumnarDataset::GetY(size_t index, size_t serie)
+{
+    wxCHECK(serie < m_series.size(), 0);
+    return m_series[serie]->GetY(index);
+}
+
+void XYColumnarDataset::GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys)
+{
+    wxCHECK_RET(serie < m_series.size(), wxT("XYColumnarDataset::GetXYBlock"));
+
+    XYColumnarSerie *s = m_series[serie];
+    wxCHECK_RET(first + count <= s->m_xs.size(), wxT("XYColumnarDataset::GetXYBlock"));
+
+    if (count == 0) {
+        return ;
+    }
+    if (xs != NULL) {
+        memcpy(xs, &s->m_xs[first], count * sizeof(double));
+    }
+    if (ys != NULL) {
+        memcpy(ys, &s->m_ys[first], count * sizeof(double));
+    }
+}
+
+const double *XYColumnarDataset::GetXColumn(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), NULL);
+    return m_series[serie]->GetXData();
+}
+
+const double *XYColumnarDataset::GetYColumn(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), NULL);
+    return m_series[serie]->GetYData();
+}
+
+bool XYColumnarDataset::IsXSorted(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), false);
+
+    XYColumnarSerie *s = m_series[serie];
+    if (s->m_xSorted < 0) {
+        s->m_xSorted = 1;
+        for (size_t n = 1; n < s->m_xs.size(); n++) {
+            if (s->m_xs[n] < s->m_xs[n - 1]) {
+                s->m_xSorted = 0;
+                break;
+            }
+        }
+    }
+    return s->m_xSorted != 0;
+}
+
+size_t XYColumnarDataset::GetSerieIndex(XYColumnarSerie *serie)
+{
+    for (size_t n = 0; n < m_series.size(); n++) {
+        if (m_series[n] == serie) {
+            return n;
+        }
+    }
+    return (size_t) -1;
+}
@@ -9,6 +9,7 @@
 
 #include <wx/xy/xydataset.h>
 #include <wx/xy/xyrenderer.h>
+#include <wx/xy/xyrangeindex.h>
 
 void ClipHoriz(Axis *axis, double &x, double &y, double x1, double y1)
 {
@@ -32,10 +33,14 @@ IMPLEMENT_CLASS(XYDataset, Dataset)
 
 XYDataset::XYDataset()
 {
+    m_xSorted = false;
+    m_xSortedVersion = 0;
+    m_useRangeIndex = false;
 }
 
 XYDataset::~XYDataset()
 {
+    ClearRangeIndexes();
 }
 
 bool XYDataset::AcceptRenderer(Renderer *renderer)
@@ -43,68 +48,340 @@ bool XYDataset::AcceptRenderer(Renderer *renderer)
     return (wxDynamicCast(renderer, XYRenderer) != NULL);
 }
 
-double XYDataset::GetMaxY()
+void XYDataset::GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys)
+{
+    for (size_t n = 0; n < count; n++) {
+        if (xs != NULL) {
+            xs[n] = GetX(first + n, serie);
+        }
+        if (ys != NULL) {
+            ys[n] = GetY(first + n, serie);
+        }
+    }
+}
+
+const double *XYDataset::GetXColumn(size_t WXUNUSED(serie))
+{
+    return NULL;
+}
+
+const double *XYDataset::GetYColumn(size_t WXUNUSED(serie))
+{
+    return NULL;
+}
+
+void XYDataset::SetXSorted(bool xSorted)
+{
+    m_xSorted = xSorted;
+}
+
+bool XYDataset::IsXSorted(size_t serie)
+{
+    if (m_xSorted) {
+        return true;
+    }
+
+    if (m_xSortedVersion != GetVersion() || m_xSortedCache.size() != GetSerieCount()) {
+        m_xSortedCache.assign(GetSerieCount(), -1);
+        m_xSortedVersion = GetVersion();
+    }
+
+    wxCHECK_MSG(serie < m_xSortedCache.size(), false, wxT("XYDataset::IsXSorted"));
+
+    if (m_xSortedCache[serie] < 0) {
+        m_xSortedCache[serie] = ScanXSorted(serie, 0, GetCount(serie)) ? 1 : 0;
+    }
+    return m_xSortedCache[serie] != 0;
+}
+
+bool XYDataset::ScanXSorted(size_t serie, size_t first, size_t count)
 {
-    double maxY = 0;
+    const size_t blockSize = 1024;
+    double xs[blockSize + 1];
+
+    // scan in blocks, each block starts with last value of previous one
+    for (size_t n = 0; n + 1 < count; n += blockSize) {
+        size_t blockCount = wxMin(blockSize + 1, count - n);
+
+        GetXYBlock(serie, first + n, blockCount, xs, NULL);
+        for (size_t i = 1; i < blockCount; i++) {
+            if (xs[i] < xs[i - 1]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void XYDataset::UpdateCaches(const DatasetChange &change)
+{
+    // x order cache must be valid for previous version
+    if (m_xSorted || m_xSortedVersion + 1 != GetVersion() || m_xSortedCache.size() != GetSerieCount()) {
+        return ;
+    }
+
+    switch (change.GetKind()) {
+    case DATASET_CHANGE_APPEND:
+        // sorted serie stays sorted, if appended points are
+        // sorted and not less than previous last point
+        for (size_t serie = 0; serie < m_xSortedCache.size(); serie++) {
+            if (!change.AffectsSerie(serie) || m_xSortedCache[serie] <= 0) {
+                continue;
+            }
+
+            size_t count = GetCount(serie);
+            size_t first = wxMin(change.GetFirst(), count);
+            if (first != 0) {
+                first--;
+            }
+
+            if (!ScanXSorted(serie, first, count - first)) {
+                m_xSortedCache[serie] = 0;
+            }
+        }
+        break;
+    case DATASET_CHANGE_REMOVE:
+        if (change.GetFirst() != 0) {
+            return ; // cache is dropped on next IsXSorted call
+        }
+
+        // removing from serie start keeps order, unsorted
+        // serie can become sorted, so it is checked again
+        for (size_t serie = 0; serie < m_xSortedCache.size(); serie++) {
+            if (change.AffectsSerie(serie) && m_xSortedCache[serie] == 0) {
+                m_xSortedCache[serie] = -1;
+            }
+        }
+        break;
+    case DATASET_CHANGE_RENAME:
+    case DATASET_CHANGE_RENDERER:
+        break;
+    default:
+        return ; // cache is dropped on next IsXSorted call
+    }
+    m_xSortedVersion = GetVersion();
+}
+
+bool XYDataset::IndexRangeForX(size_t serie, double xMin, double xMax, size_t &first, size_t &last)
+{
+    size_t count = GetCount(serie);
+
+    if (count == 0 || xMin > xMax) {
+        return false;
+    }
+
+    if (!IsXSorted(serie)) {
+        first = 0;
+        last = count - 1;
+        return true;
+    }
+
+    size_t begin = FindXIndex(serie, xMin, false);
+    size_t end = FindXIndex(serie, xMax, true);
+    if (begin >= end) {
+        return false;
+    }
+
+    first = begin;
+    last = end - 1;
+    return true;
+}
+
+size_t XYDataset::FindXIndex(size_t serie, double x, bool upper)
+{
+    const double *xs = GetXColumn(serie);
+
+    size_t low = 0;
+    size_t high = GetCount(serie);
+
+    while (low < high) {
+        size_t mid = low + (high - low) / 2;
+        double value = (xs != NULL) ? xs[mid] : GetX(mid, serie);
+
+        if (upper ? (value <= x) : (value < x)) {
+            low = mid + 1;
+        }
+        else {
+            high = mid;
+        }
+    }
+    return low;
+}
+
+void XYDataset::SetUseRangeIndex(bool useRangeIndex)
+{
+    m_useRangeIndex = useRangeIndex;
+    if (!m_useRangeIndex) {
+        ClearRangeIndexes();
+    }
+}
+
+bool XYDataset::GetYRangeForX(double xMin, double xMax, double &yMin, double &yMax)
+{
+    bool hasValues = false;
 
     for (size_t serie = 0; serie < GetSerieCount(); serie++) {
-        for (size_t n = 0; n < GetCount(serie); n++) {
-            double y = GetY(n, serie);
-            if (n == 0 && serie == 0)
-                maxY = y;
-            else
-                maxY = wxMax(maxY, y);
+        size_t first, last;
+        if (!IndexRangeForX(serie, xMin, xMax, first, last)) {
+            continue;
+        }
+
+        double minValue = 0, maxValue = 0;
+        bool found = false;
+
+        if (IsXSorted(serie)) {
+            if (m_useRangeIndex) {
+                found = GetRangeIndex(serie)->GetMinMax(this, serie, first, last, minValue, maxValue);
+            }
+            else {
+                for (size_t n = first; n <= last; n++) {
+                    double y = GetY(n, serie);
+
+                    minValue = found ? wxMin(minValue, y) : y;
+                    maxValue = found ? wxMax(maxValue, y) : y;
+                    found = true;
+                }
+            }
+        }
+        else {
+            // unsorted serie, check every point
+            for (size_t n = first; n <= last; n++) {
+                double x = GetX(n, serie);
+                if (x < xMin || x > xMax) {
+                    continue;
+                }
+
+                double y = GetY(n, serie);
+                minValue = found ? wxMin(minValue, y) : y;
+                maxValue = found ? wxMax(maxValue, y) : y;
+                found = true;
+            }
+        }
+
+        if (found) {
+            yMin = hasValues ? wxMin(yMin, minValue) : minValue;
+            yMax = hasValues ? wxMax(yMax, maxValue) : maxValue;
+            hasValues = true;
         }
     }
+    return hasValues;
+}
+
+void XYDataset::InvalidateBounds()
+{
+    Dataset::InvalidateBounds();
+
+    for (size_t n = 0; n < m_rangeIndexes.size(); n++) {
+        m_rangeIndexes[n]->Truncate(0);
+    }
+}
+
+void XYDataset::InvalidateRangeIndex(size_t serie, size_t first)
+{
+    if (serie < m_rangeIndexes.size()) {
+        m_rangeIndexes[serie]->Truncate(first);
+    }
+}
+
+void XYDataset::RemoveRangeIndexFront(size_t serie, size_t count)
+{
+    if (serie < m_rangeIndexes.size()) {
+        m_rangeIndexes[serie]->RemoveFront(count);
+    }
+}
+
+XYRangeIndex *XYDataset::GetRangeIndex(size_t serie)
+{
+    // create indexes for new series
+    while (m_rangeIndexes.size() <= serie) {
+        m_rangeIndexes.push_back(new XYRangeIndex());
+    }
+    return m_rangeIndexes[serie];
+}
+
+void XYDataset::ClearRangeIndexes()
+{
+    for (size_t n = 0; n < m_rangeIndexes.size(); n++) {
+        wxDELETE(m_rangeIndexes[n]);
+    }
+    m_rangeIndexes.clear();
+}
+
+double XYDataset::GetMaxY()
+{
+    double minY, maxY;
+
+    if (!GetBounds(BOUNDS_Y, minY, maxY)) {
+        return 0;
+    }
     return maxY;
 }
 
 double XYDataset::GetMinY()
 {
-    double minY = 0;
+    double minY, maxY;
 
-    for (size_t serie = 0; serie < GetSerieCount(); serie++) {
-        for (size_t n = 0; n < GetCount(serie); n++) {
-            double y = GetY(n, serie);
-            if (n == 0 && serie == 0)
-                minY = y;
-            else
-                minY = wxMin(minY, y);
-        }
+    if (!GetBounds(BOUNDS_Y, minY, maxY)) {
+        return 0;
     }
     return minY;
 }
 
 double XYDataset::GetMaxX()
 {
-    double maxX = 0;
+    double minX, maxX;
 
-    for (size_t serie = 0; serie < GetSerieCount(); serie++) {
-        for (size_t n = 0; n < GetCount(serie); n++) {
-            double x = GetX(n, serie);
-            if (n == 0 && serie == 0)
-                maxX = x;
-            else
-                maxX = wxMax(maxX, x);
-        }
+    if (!GetBounds(BOUNDS_X, minX, maxX)) {
+        return 0;
     }
     return maxX;
 }
 
 double XYDataset::GetMinX()
 {
-    double minX = 0;
+    double minX, maxX;
+
+    if (!GetBounds(BOUNDS_X, minX, maxX)) {
+        return 0;
+    }
+    return minX;
+}
+
+bool XYDataset::CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue)
+{
+    if (dim != BOUNDS_X && dim != BOUNDS_Y) {
+        return Dataset::CalcBounds(dim, minValue, maxValue);
+    }
+
+    bool hasValues = false;
 
     for (size_t serie = 0; serie < GetSerieCount(); serie++) {
+        if (dim == BOUNDS_Y && m_useRangeIndex) {
+            size_t count = GetCount(serie);
+            double minY, maxY;
+
+            if (count != 0 && GetRangeIndex(serie)->GetMinMax(this, serie, 0, count - 1, minY, maxY)) {
+                minValue = hasValues ? wxMin(minValue, minY) : minY;
+                maxValue = hasValues ? wxMax(maxValue, maxY) : maxY;
+                hasValues = true;
+            }
+            continue;
+        }
+
         for (size_t n = 0; n < GetCount(serie); n++) {
-            double x = GetX(n, serie);
-            if (n == 0 && serie == 0)
-                minX = x;
-            else
-                minX = wxMin(minX, x);
+            double value = (dim == BOUNDS_X) ? GetX(n, serie) : GetY(n, serie);
+
+            if (!hasValues) {
+                minValue = maxValue = value;
+                hasValues = true;
+            }
+            else {
+                minValue = wxMin(minValue, value);
+                maxValue = wxMax(maxValue, value);
+            }
         }
     }
-    return minX;
+    return hasValues;
 }
 
 double XYDataset::GetMinValue(bool verticalAxis)
@@ -126,3 +403,68 @@ double XYDataset::GetMaxValue(bool verticalAxis)
         return GetMaxX();
     }
 }
+
+//
+// XYDataBlock
+//
+
+XYDataBlock::XYDataBlock()
+{
+    m_xs = NULL;
+    m_ys = NULL;
+    m_count = 0;
+}
+
+XYDataBlock::~XYDataBlock()
+{
+}
+
+void XYDataBlock::Load(XYDataset *dataset, size_t serie, size_t first, size_t count)
+{
+    m_count = count;
+    if (count == 0) {
+        m_xs = m_ys = NULL;
+        return ;
+    }
+
+    const double *xColumn = dataset->GetXColumn(serie);
+    const double *yColumn = dataset->GetYColumn(serie);
+
+    double *xs = NULL;
+    double *ys = NULL;
+
+    if (xColumn == NULL) {
+        if (m_xBuffer.size() < count) {
+            m_xBuffer.resize(count);
+        }
+        xs = &m_xBuffer[0];
+    }
+    if (yColumn == NULL) {
+        if (m_yBuffer.size() < count) {
+            m_yBuffer.resize(count);
+        }
+        ys = &m_yBuffer[0];
+    }
+
+    if (xs != NULL || ys != NULL) {
+        dataset->GetXYBlock(serie, first, count, xs, ys);
+    }
+
+    m_xs = (xColumn != NULL) ? xColumn + first : xs;
+    m_ys = (yColumn != NULL) ? yColumn + first : ys;
+}
+
+void XYDataBlock::ToGraphics(const AxisTransform &horizTransform, const AxisTransform &vertTransform)
+{
+    if (m_count == 0) {
+        return ;
+    }
+
+    if (m_xCoords.size() < m_count) {
+        m_xCoords.resize(m_count);
+        m_yCoords.resize(m_count);
+    }
+
+    horizTransform.ToGraphics(m_xs, &m_xCoords[0], m_count);
+    vertTransform.ToGraphics(m_ys, &m_yCoords[0], m_count);
+}
@@ -89,18 +89,14 @@ void XYDynamicSerie::AddXY(const wxRealPoint& xy)
 {
     m_data.Add(xy);
 
-    if (m_dataset != NULL) {
-        m_dataset->DatasetChanged();
-    }
+    DataAdded(m_data.GetCount() - 1, 1);
 }
 
 void XYDynamicSerie::AddXY(const wxRealPointArray& data)
 {
     WX_APPEND_ARRAY(m_data, data)
 
-    if (m_dataset != NULL) {
-        m_dataset->DatasetChanged();
-    }
+    DataAdded(m_data.GetCount() - data.GetCount(), data.GetCount());
 }
 
 void XYDynamicSerie::Insert(size_t index, double x, double y)
@@ -112,9 +108,7 @@ void XYDynamicSerie::Insert(size_t index, const wxRealPoint& xy)
 {
     m_data.Insert(xy, index);
 
-    if (m_dataset != NULL) {
-        m_dataset->DatasetChanged();
-    }
+    DataAdded(index, 1);
 }
 
 void XYDynamicSerie::Insert(size_t index, const wxRealPointArray& data)
@@ -127,17 +121,25 @@ void XYDynamicSerie::Insert(size_t index, const wxRealPointArray& data)
     arr.RemoveAt(0, index);
     WX_APPEND_ARRAY(m_data, arr);
 
-    if (m_dataset != NULL) {
-        m_dataset->DatasetChanged();
-    }
+    DataAdded(index, data.GetCount());
 }
 
 void XYDynamicSerie::Remove(size_t index, size_t count/* = 1*/)
 {
+    if (m_dataset != NULL) {
+        // bounds need rescan only if removed point was an extreme
+        for (size_t n = index; n < index + count && n < m_data.GetCount(); n++) {
+            m_dataset->ValueRemoved(BOUNDS_X, m_data[n].x);
+            m_dataset->ValueRemoved(BOUNDS_Y, m_data[n].y);
+        }
+        m_dataset->InvalidateRangeIndex(m_dataset->m_series.Index(this), index);
+    }
+
     m_data.RemoveAt(index, count);
 
     if (m_dataset != NULL) {
-        m_dataset->DatasetChanged();
+        m_dataset->DatasetChanged(DatasetChange(DATASET_CHANGE_REMOVE,
+                m_dataset->m_series.Index(this), index, count), false);
     }
 }
 
@@ -146,7 +148,7 @@ void XYDynamicSerie::Clear()
     m_data.Clear();
 
     if (m_dataset != NULL) {
-        m_dataset->DatasetChanged();
+        m_dataset->DatasetChanged(DatasetChange(DATASET_CHANGE_CLEAR, m_dataset->m_series.Index(this)));
     }
 }
 
@@ -155,6 +157,28 @@ void XYDynamicSerie::SetDataset(XYDynamicDataset *dataset)
     m_dataset = dataset;
 }
 
+void XYDynamicSerie::DataAdded(size_t first, size_t count)
+{
+    if (m_dataset == NULL) {
+        return ;
+    }
+
+    size_t serie = m_dataset->m_series.Index(this);
+
+    // points after first are shifted, when added not to the end
+    m_dataset->InvalidateRangeIndex(serie, first);
+
+    // widen cached bounds with added points, instead of full rescan
+    for (size_t n = first; n < first + count; n++) {
+        m_dataset->ExtendBounds(BOUNDS_X, m_data[n].x);
+        m_dataset->ExtendBounds(BOUNDS_Y, m_data[n].y);
+    }
+
+    DATASET_CHANGE_KIND kind = (first + count == m_data.GetCount())
+        ? DATASET_CHANGE_APPEND : DATASET_CHANGE_INSERT;
+    m_dataset->DatasetChanged(DatasetChange(kind, serie, first, count), false);
+}
+
 //
 // XYDynamicDataset
 //
@@ -199,7 +223,7 @@ wxString XYDynamicDataset::GetSerieName(size_t serie)
 void XYDynamicDataset::SetSerieName(size_t serie, const wxString &name)
 {
     m_series[serie]->SetName(name);
-    DatasetChanged();
+    DatasetChanged(DatasetChange(DATASET_CHANGE_RENAME, serie), false);
 }
 
 double XYDynamicDataset::GetX(size_t index, size_t serie)
@@ -220,3 +244,22 @@ size_t XYDynamicDataset::GetCount(size_t serie)
 {
     return m_series[serie]->GetCount();
 }
+
+void XYDynamicDataset::GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys)
+{
+    wxCHECK_RET(serie < m_series.Count(), wxT("XYDynamicDataset::GetXYBlock"));
+
+    const wxRealPointArray &data = m_series[serie]->m_data;
+    wxCHECK_RET(first + count <= data.GetCount(), wxT("XYDynamicDataset::GetXYBlock"));
+
+    for (size_t n = 0; n < count; n++) {
+        const wxRealPoint &pt = data[first + n];
+
+        if (xs != NULL) {
+            xs[n] = pt.x;
+        }
+        if (ys != NULL) {
+            ys[n] = pt.y;
+        }
+    }
+}
@@ -0,0 +1,115 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xyexternaldataset.cpp
+// Purpose: xy dataset over caller owned records implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/xy/xyexternaldataset.h>
+
+IMPLEMENT_CLASS(XYExternalDataset, XYDataset)
+
+XYExternalDataset::XYExternalDataset(ExternalBuffer *buffer)
+{
+    wxASSERT_MSG(buffer != NULL, wxT("XYExternalDataset: buffer is NULL"));
+
+    m_buffer = buffer;
+}
+
+XYExternalDataset::~XYExternalDataset()
+{
+    wxDELETE(m_buffer);
+}
+
+void XYExternalDataset::AddSerie(const wxString &name, const ExternalField &xField, const ExternalField &yField)
+{
+    Serie serie;
+    serie.name = name;
+    serie.xField = xField;
+    serie.yField = yField;
+
+    m_series.push_back(serie);
+    DatasetChanged();
+}
+
+void XYExternalDataset::RecordsAppended(size_t count)
+{
+    if (count == 0) {
+        return ;
+    }
+
+    size_t first = m_buffer->GetCount();
+    m_buffer->SetCount(first + count);
+
+    for (size_t serie = 0; serie < m_series.size(); serie++) {
+        for (size_t n = first; n < first + count; n++) {
+            ExtendBounds(BOUNDS_X, m_buffer->GetValue(n, m_series[serie].xField));
+            ExtendBounds(BOUNDS_Y, m_buffer->GetValue(n, m_series[serie].yField));
+        }
+    }
+    DatasetChanged(DatasetChange(DATASET_CHANGE_APPEND, DATASET_ALL_SERIES, first, count), false);
+}
+
+size_t XYExternalDataset::GetSerieCount()
+{
+    return m_series.size();
+}
+
+wxString XYExternalDataset::GetSerieName(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), wxEmptyString);
+    return m_series[serie].name;
+}
+
+size_t XYExternalDataset::GetCount(size_t WXUNUSED(serie))
+{
+    return m_buffer->GetCount();
+}
+
+double XYExternalDataset::GetX(size_t index, size_t serie)
+{
+    wxCHECK(serie < m_series.size(), 0);
+    return m_buffer->GetValue(index, m_series[serie].xField);
+}
+
+double XYExternalDataset::GetY(size_t index, size_t serie)
+{
+    wxCHECK(serie < m_series.size(), 0);
+    return m_buffer->GetValue(index, m_series[serie].yField);
+}
+
+void XYExternalDataset::GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys)
+{
+    wxCHECK_RET(serie < m_series.size(), wxT("XYExternalDataset::GetXYBlock"));
+
+    if (xs != NULL) {
+        m_buffer->GetValues(first, count, m_series[serie].xField, xs);
+    }
+    if (ys != NULL) {
+        m_buffer->GetValues(first, count, m_series[serie].yField, ys);
+    }
+}
+
+const double *XYExternalDataset::GetXColumn(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), NULL);
+    return m_buffer->GetColumn(m_series[serie].xField);
+}
+
+const double *XYExternalDataset::GetYColumn(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), NULL);
+    return m_buffer->GetColumn(m_series[serie].yField);
+}
+
+bool XYExternalDataset::IsXSorted(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), false);
+
+    if (m_series[serie].xField.type == FIELD_INDEX) {
+        return true;
+    }
+    return XYDataset::IsXSorted(serie);
+}
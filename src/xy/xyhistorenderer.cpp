@@ -47,18 +47,50 @@ void XYHistoRenderer::DrawBar(int serie, wxDC &dc, wxRect rcData, wxCoord x, wxC
 
 void XYHistoRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
+    XYDataBlock block;
+
+    AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+    AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
+
     FOREACH_SERIE(serie, dataset) {
-        FOREACH_DATAITEM(n, serie, dataset) {
+        // horizontal axis shows x values only for vertical bars
+        size_t first = 0;
+        size_t count = dataset->GetCount(serie);
+        if (m_vertical && !GetVisibleRange(dc, horizTransform, horizAxis, dataset, serie, first, count)) {
+            continue;
+        }
+
+        block.Load(dataset, serie, first, count);
+        const double *xs = block.GetX();
+        const double *ys = block.GetY();
+
+        // for horizontal bars x values are on vertical axis
+        if (m_vertical) {
+            block.ToGraphics(horizTransform, vertTransform);
+        }
+        else {
+            block.ToGraphics(vertTransform, horizTransform);
+        }
+        const wxCoord *xgs = block.GetXCoords();
+        const wxCoord *ygs = block.GetYCoords();
+
+        for (size_t n = 0; n < block.GetCount(); n++) {
             double xVal;
             double yVal;
+            wxCoord x;
+            wxCoord y;
 
             if (m_vertical) {
-                xVal = dataset->GetX(n, serie);
-                yVal = dataset->GetY(n, serie);
+                xVal = xs[n];
+                yVal = ys[n];
+                x = xgs[n];
+                y = ygs[n];
             }
             else {
-                xVal = dataset->GetY(n, serie);
-                yVal = dataset->GetX(n, serie);
+                xVal = ys[n];
+                yVal = xs[n];
+                x = ygs[n];
+                y = xgs[n];
             }
 
             if (!horizAxis->IsVisible(xVal) ||
@@ -66,9 +98,6 @@ void XYHistoRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis,
                 continue;
             }
 
-            wxCoord x = horizAxis->ToGraphics(dc, rc.x, rc.width, xVal);
-            wxCoord y = vertAxis->ToGraphics(dc, rc.y, rc.height, yVal);
-
             DrawBar(serie, dc, rc, x, y);
         }
     }
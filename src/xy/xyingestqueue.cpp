@@ -0,0 +1,191 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xyingestqueue.cpp
+// Purpose: thread safe xy sample queue and GUI thread drainer implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/xy/xyingestqueue.h>
+
+// samples are moved from queue to dataset by blocks of this size
+#define INGEST_DRAIN_BLOCK 4096
+
+//
+// XYIngestQueue
+//
+
+XYIngestQueue::XYIngestQueue(size_t capacity)
+{
+    size_t size = 2;
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    // ring buffer of power of two size, so position is wrapped by mask
+    m_xs = new double[size];
+    m_ys = new double[size];
+    m_mask = size - 1;
+
+    m_enqueuePos = 0;
+    m_dequeuePos = 0;
+    m_dropped = 0;
+}
+
+XYIngestQueue::~XYIngestQueue()
+{
+    wxDELETEA(m_xs);
+    wxDELETEA(m_ys);
+}
+
+bool XYIngestQueue::Push(double x, double y)
+{
+    wxCriticalSectionLocker locker(m_lock);
+
+    return PushLocked(x, y);
+}
+
+size_t XYIngestQueue::Push(const double *xs, const double *ys, size_t count)
+{
+    wxCriticalSectionLocker locker(m_lock);
+
+    size_t pushed = 0;
+
+    for (size_t n = 0; n < count; n++) {
+        if (PushLocked(xs[n], ys[n])) {
+            pushed++;
+        }
+    }
+    return pushed;
+}
+
+bool XYIngestQueue::PushLocked(double x, double y)
+{
+    if (m_enqueuePos - m_dequeuePos > m_mask) {
+        // queue is full
+        m_dropped++;
+        return false;
+    }
+
+    m_xs[m_enqueuePos & m_mask] = x;
+    m_ys[m_enqueuePos & m_mask] = y;
+    m_enqueuePos++;
+    return true;
+}
+
+size_t XYIngestQueue::Pop(double *xs, double *ys, size_t maxCount)
+{
+    wxCriticalSectionLocker locker(m_lock);
+
+    size_t count = wxMin(maxCount, m_enqueuePos - m_dequeuePos);
+
+    for (size_t n = 0; n < count; n++) {
+        xs[n] = m_xs[m_dequeuePos & m_mask];
+        ys[n] = m_ys[m_dequeuePos & m_mask];
+        m_dequeuePos++;
+    }
+    return count;
+}
+
+size_t XYIngestQueue::GetDropped()
+{
+    wxCriticalSectionLocker locker(m_lock);
+
+    return m_dropped;
+}
+
+//
+// XYIngestTarget
+//
+
+XYIngestTarget::XYIngestTarget()
+{
+}
+
+XYIngestTarget::~XYIngestTarget()
+{
+}
+
+//
+// XYIngestDrainer
+//
+
+BEGIN_EVENT_TABLE(XYIngestDrainer, wxEvtHandler)
+    EVT_TIMER(wxID_ANY, XYIngestDrainer::OnTimer)
+END_EVENT_TABLE()
+
+XYIngestDrainer::XYIngestDrainer()
+: m_xs(INGEST_DRAIN_BLOCK), m_ys(INGEST_DRAIN_BLOCK)
+{
+    m_timer.SetOwner(this);
+}
+
+XYIngestDrainer::~XYIngestDrainer()
+{
+    m_timer.Stop();
+
+    for (size_t n = 0; n < m_entries.size(); n++) {
+        wxDELETE(m_entries[n].target);
+    }
+}
+
+void XYIngestDrainer::AddQueue(XYIngestQueue *queue, XYIngestTarget *target)
+{
+    wxCHECK_RET(queue != NULL && target != NULL, wxT("XYIngestDrainer::AddQueue"));
+
+    Entry entry;
+    entry.queue = queue;
+    entry.target = target;
+    m_entries.push_back(entry);
+}
+
+void XYIngestDrainer::Start(int interval)
+{
+    m_timer.Start(interval);
+}
+
+void XYIngestDrainer::Stop()
+{
+    m_timer.Stop();
+}
+
+size_t XYIngestDrainer::Drain()
+{
+    size_t total = 0;
+
+    // all appends of this drain are batched into one notification per dataset
+    for (size_t n = 0; n < m_entries.size(); n++) {
+        m_entries[n].target->GetDataset()->BeginUpdate();
+    }
+
+    for (size_t n = 0; n < m_entries.size(); n++) {
+        Entry &entry = m_entries[n];
+
+        // at most one queue capacity is drained, so fast producers
+        // cannot hold GUI thread here
+        size_t limit = entry.queue->GetCapacity();
+        size_t drained = 0;
+
+        while (drained < limit) {
+            size_t count = entry.queue->Pop(&m_xs[0], &m_ys[0], wxMin(m_xs.size(), limit - drained));
+            if (count == 0) {
+                break;
+            }
+
+            entry.target->Append(&m_xs[0], &m_ys[0], count);
+            drained += count;
+        }
+        total += drained;
+    }
+
+    for (size_t n = 0; n < m_entries.size(); n++) {
+        m_entries[n].target->GetDataset()->EndUpdate();
+    }
+    return total;
+}
+
+void XYIngestDrainer::OnTimer(wxTimerEvent &WXUNUSED(ev))
+{
+    Drain();
+}
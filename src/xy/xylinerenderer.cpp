@@ -12,6 +12,9 @@
 
 using namespace std;
 
+// wider pens have round tips, which square raster pen tip does not match
+#define RASTER_MAX_PEN_WIDTH 2
+
 IMPLEMENT_CLASS(XYLineRendererBase, XYRenderer)
 IMPLEMENT_CLASS(XYLineRenderer, XYLineRendererBase)
 IMPLEMENT_CLASS(XYLineStepRenderer, XYLineRendererBase)
@@ -41,14 +44,14 @@ void XYLineRendererBase::SetSeriePen(size_t serie, wxPen *pen)
 wxPen *XYLineRendererBase::GetSeriePen(size_t serie)
 {
     if (m_seriePens.find(serie) == m_seriePens.end()) {
-        return wxThePenList->FindOrCreatePen(GetDefaultColour(serie), m_defaultPenWidth, m_defaultPenStyle);
+        return DrawResources::FindOrCreatePen(GetDefaultColour(serie), m_defaultPenWidth, m_defaultPenStyle);
     }
     return &m_seriePens[serie];
 }
 
 void XYLineRendererBase::SetSerieColour(size_t serie, wxColour *colour)
 {
-    SetSeriePen(serie, wxThePenList->FindOrCreatePen(*colour, m_defaultPenWidth, m_defaultPenStyle));
+    SetSeriePen(serie, DrawResources::FindOrCreatePen(*colour, m_defaultPenWidth, m_defaultPenStyle));
 }
 
 wxColour XYLineRendererBase::GetSerieColour(size_t serie)
@@ -70,6 +73,33 @@ void XYLineRendererBase::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAx
   }
 }
 
+bool XYLineRendererBase::CanRasterize(XYDataset *dataset)
+{
+    if (m_drawLines && !CanRasterizeLines(dataset)) {
+        return false;
+    }
+
+    if (m_drawSymbols) {
+        FOREACH_SERIE(serie, dataset) {
+            if (!GetSerieSymbol(serie)->CanRasterize()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+void XYLineRendererBase::Rasterize(ChartRaster &raster, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+{
+    if (m_drawLines) {
+        RasterizeLines(raster, rc, horizAxis, vertAxis, dataset);
+    }
+
+    if (m_drawSymbols) {
+        RasterizeSymbols(raster, rc, horizAxis, vertAxis, dataset);
+    }
+}
+
 void XYLineRendererBase::DrawLegendSymbol(wxDC &dc, wxRect rcSymbol, size_t serie)
 {
     if (m_drawLines) {
@@ -88,24 +118,78 @@ void XYLineRendererBase::DrawLegendSymbol(wxDC &dc, wxRect rcSymbol, size_t seri
 
 void XYLineRendererBase::DrawSymbols(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
+  XYDataBlock block;
+
+  AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+  AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
+
   FOREACH_SERIE(serie, dataset) {
     Symbol *symbol = GetSerieSymbol(serie);
     wxColour color = GetSerieColour(serie);
 
-    for(size_t n = 0; n < dataset->GetCount(serie); ++n) {
-      double x = dataset->GetX(n, serie);
-      double y = dataset->GetY(n, serie);
+    size_t first, count;
+    if (!GetVisibleRange(dc, horizTransform, horizAxis, dataset, serie, first, count)) {
+      continue;
+    }
 
-      if(horizAxis->IsVisible(x) && vertAxis->IsVisible(y)) {
-        int xg = horizAxis->ToGraphics(dc, rc.x, rc.width, x);
-        int yg = vertAxis->ToGraphics(dc, rc.y, rc.height, y);
+    block.Load(dataset, serie, first, count);
+    block.ToGraphics(horizTransform, vertTransform);
+    const double *xs = block.GetX();
+    const double *ys = block.GetY();
+    const wxCoord *xgs = block.GetXCoords();
+    const wxCoord *ygs = block.GetYCoords();
 
-        symbol->Draw(dc, xg, yg, color);
+    for(size_t n = 0; n < block.GetCount(); ++n) {
+      if(horizAxis->IsVisible(xs[n]) && vertAxis->IsVisible(ys[n])) {
+        symbol->Draw(dc, xgs[n], ygs[n], color);
       }
     }
   }
 }
 
+bool XYLineRendererBase::CanRasterizeLines(XYDataset *WXUNUSED(dataset))
+{
+    return false;
+}
+
+void XYLineRendererBase::RasterizeLines(ChartRaster &WXUNUSED(raster), wxRect WXUNUSED(rc),
+        Axis *WXUNUSED(horizAxis), Axis *WXUNUSED(vertAxis), XYDataset *WXUNUSED(dataset))
+{
+    // default - do nothing
+}
+
+void XYLineRendererBase::RasterizeSymbols(ChartRaster &raster, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+{
+    XYDataBlock block;
+
+    AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+    AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
+
+    FOREACH_SERIE(serie, dataset) {
+        Symbol *symbol = GetSerieSymbol(serie);
+
+        size_t first, count;
+        if (!GetVisibleRange(raster.GetClippingRect(), horizTransform, horizAxis, dataset, serie, first, count)) {
+            continue;
+        }
+
+        raster.SetColour(GetSerieColour(serie));
+
+        block.Load(dataset, serie, first, count);
+        block.ToGraphics(horizTransform, vertTransform);
+        const double *xs = block.GetX();
+        const double *ys = block.GetY();
+        const wxCoord *xgs = block.GetXCoords();
+        const wxCoord *ygs = block.GetYCoords();
+
+        for (size_t n = 0; n < block.GetCount(); n++) {
+            if (horizAxis->IsVisible(xs[n]) && vertAxis->IsVisible(ys[n])) {
+                symbol->Rasterize(raster, xgs[n], ygs[n]);
+            }
+        }
+    }
+}
+
 //
 // XYLineRenderer
 //
@@ -113,6 +197,15 @@ void XYLineRendererBase::DrawSymbols(wxDC &dc, wxRect rc, Axis *horizAxis, Axis
 XYLineRenderer::XYLineRenderer(bool drawSymbols, bool drawLines, int defaultPenWidth, wxPenStyle defaultPenStyle)
 : XYLineRendererBase(drawSymbols, drawLines, defaultPenWidth, defaultPenStyle)
 {
+    m_decimation = false;
+}
+
+void XYLineRenderer::SetDecimation(bool decimation)
+{
+    if (m_decimation != decimation) {
+        m_decimation = decimation;
+        FireNeedRedraw();
+    }
 }
 
 XYLineRenderer::~XYLineRenderer()
@@ -121,34 +214,22 @@ XYLineRenderer::~XYLineRenderer()
 
 void XYLineRenderer::DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
+    XYDataBlock block;
+    XYLinePoints linePoints(m_decimation);
+
+    AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+    AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
+
+    wxCoord clipX, clipY, clipWidth, clipHeight;
+    dc.GetClippingBox(&clipX, &clipY, &clipWidth, &clipHeight);
+    wxRect clip(clipX, clipY, clipWidth, clipHeight);
+
     FOREACH_SERIE(serie, dataset) {
-        if (dataset->GetCount(serie) < 2) {
+        if (!GetLinePoints(clip, rc, horizTransform, vertTransform, horizAxis, dataset, serie, block, linePoints)) {
             continue;
         }
 
-        size_t sz = dataset->GetCount(serie);
-        vector<wxPoint> pts;
-        pts.reserve(sz);
-
-        double x_min, x_max;
-        horizAxis->GetDataBounds(x_min, x_max);
-        double x0, y0;
-        for (size_t n = 0; n < sz; n++) {
-            x0 = dataset->GetX(n, serie);
-            y0 = dataset->GetY(n, serie);
-            if (x0 < x_min || x0 > x_max)
-                continue;
-            // translate to graphics coordinates.
-            wxPoint pt;
-            pt.x = horizAxis->ToGraphics(dc, rc.x, rc.width, x0);
-            pt.y = vertAxis->ToGraphics(dc, rc.y, rc.height, y0);
-            if (pts.empty())
-                pts.push_back(pt);
-            else {
-                if (pts.back() != pt)
-                    pts.push_back(pt);
-            }
-        }
+        vector<wxPoint> &pts = linePoints.GetPoints();
 
         wxPen *pen = GetSeriePen(serie);
         dc.SetPen(*pen);
@@ -187,6 +268,77 @@ void XYLineRenderer::DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertA
   }
 }
 
+bool XYLineRenderer::CanRasterizeLines(XYDataset *dataset)
+{
+    FOREACH_SERIE(serie, dataset) {
+        wxPen *pen = GetSeriePen(serie);
+
+        if (pen->GetStyle() != wxPENSTYLE_SOLID || pen->GetWidth() > RASTER_MAX_PEN_WIDTH) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void XYLineRenderer::RasterizeLines(ChartRaster &raster, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
+{
+    XYDataBlock block;
+    XYLinePoints linePoints(m_decimation);
+
+    AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+    AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
+
+    FOREACH_SERIE(serie, dataset) {
+        if (!GetLinePoints(raster.GetClippingRect(), rc, horizTransform, vertTransform, horizAxis, dataset, serie, block, linePoints)) {
+            continue;
+        }
+
+        vector<wxPoint> &pts = linePoints.GetPoints();
+
+        wxPen *pen = GetSeriePen(serie);
+        raster.SetColour(pen->GetColour());
+        raster.SetLineWidth(pen->GetWidth());
+        raster.DrawLines(pts.size(), &pts[0]);
+    }
+}
+
+bool XYLineRenderer::GetLinePoints(const wxRect &clip, wxRect rc, const AxisTransform &horizTransform,
+        const AxisTransform &vertTransform, Axis *horizAxis, XYDataset *dataset, size_t serie,
+        XYDataBlock &block, XYLinePoints &linePoints)
+{
+    if (dataset->GetCount(serie) < 2) {
+        return false;
+    }
+
+    // take one point beyond visible range on each side,
+    // so lines are continued to plot edges
+    size_t first, count;
+    if (!GetVisibleRange(clip, horizTransform, horizAxis, dataset, serie, first, count, 1)) {
+        return false;
+    }
+
+    block.Load(dataset, serie, first, count);
+    // translate to graphics coordinates.
+    block.ToGraphics(horizTransform, vertTransform);
+    const double *xs = block.GetX();
+    const wxCoord *xgs = block.GetXCoords();
+    const wxCoord *ygs = block.GetYCoords();
+
+    size_t sz = block.GetCount();
+    // decimated line has at most four points per pixel column
+    linePoints.Clear(m_decimation ? wxMin(sz, (size_t) (4 * rc.width + 4)) : sz);
+
+    double x_min, x_max;
+    horizAxis->GetDataBounds(x_min, x_max);
+    for (size_t n = 0; n < sz; n++) {
+        if (xs[n] < x_min || xs[n] > x_max)
+            continue;
+        linePoints.Add(wxPoint(xgs[n], ygs[n]));
+    }
+
+    return linePoints.GetPoints().size() >= 2;
+}
+
 //
 // XYLineStepRenderer
 //
@@ -202,6 +354,11 @@ XYLineStepRenderer::~XYLineStepRenderer()
 
 void XYLineStepRenderer::DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYDataset *dataset)
 {
+    XYDataBlock block;
+
+    AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+    AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
+
     FOREACH_SERIE(serie, dataset) {
         if (dataset->GetCount(serie) < 2) {
             continue;
@@ -213,16 +370,32 @@ void XYLineStepRenderer::DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *v
             continue; // nothing visible
         }
 
+        // for sorted serie, last point to draw is first one beyond visible range
+        size_t last = dataset->GetCount(serie) - 1;
+        if (dataset->IsXSorted(serie)) {
+            double minValue, maxValue;
+            horizAxis->GetVisibleBounds(minValue, maxValue);
+
+            last = wxMin(last, dataset->FindXIndex(serie, maxValue, true));
+        }
+        if (last <= first) {
+            continue;
+        }
+
+        block.Load(dataset, serie, first, last - first + 1);
+        const double *xs = block.GetX();
+        const double *ys = block.GetY();
+
         // Set serie pen
         wxPen *pen = GetSeriePen(serie);
         dc.SetPen(*pen);
 
         // iterate until two points will be invisible
-        for (size_t n = first; n < dataset->GetCount(serie) - 1; n++) {
-            double x0 = dataset->GetX(n, serie);
-            double y0 = dataset->GetY(n, serie);
-            double x1 = dataset->GetX(n + 1, serie);
-            double y1 = dataset->GetY(n + 1, serie);
+        for (size_t n = 0; n < block.GetCount() - 1; n++) {
+            double x0 = xs[n];
+            double y0 = ys[n];
+            double x1 = xs[n + 1];
+            double y1 = ys[n + 1];
 
             if (!horizAxis->IntersectsWindow(x0, x1) ||
                     !vertAxis->IntersectsWindow(y0, y1)) {
@@ -238,10 +411,10 @@ void XYLineStepRenderer::DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *v
             wxCoord xg0, yg0;
             wxCoord xg1, yg1;
 
-            xg0 = horizAxis->ToGraphics(dc, rc.x, rc.width, x0);
-            yg0 = vertAxis->ToGraphics(dc, rc.y, rc.height, y0);
-            xg1 = horizAxis->ToGraphics(dc, rc.x, rc.width, x1);
-            yg1 = vertAxis->ToGraphics(dc, rc.y, rc.height, y1);
+            xg0 = horizTransform.ToGraphics(x0);
+            yg0 = vertTransform.ToGraphics(y0);
+            xg1 = horizTransform.ToGraphics(x1);
+            yg1 = vertTransform.ToGraphics(y1);
 
             dc.DrawLine(xg0, yg0, xg1, yg1);
         }
@@ -250,6 +423,18 @@ void XYLineStepRenderer::DrawLines(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *v
 
 size_t XYLineStepRenderer::GetFirstVisibleIndex(Axis *horizAxis, Axis *vertAxis, XYDataset *dataset, size_t serie)
 {
+    if (dataset->IsXSorted(serie)) {
+        double minValue, maxValue;
+        horizAxis->GetVisibleBounds(minValue, maxValue);
+
+        // segment starting at last point before visible range is first visible one
+        size_t n = dataset->FindXIndex(serie, minValue);
+        if (n > 0) {
+            n--;
+        }
+        return (n < dataset->GetCount(serie) - 1) ? n : (size_t) -1;
+    }
+
     for (size_t n = 0; n < dataset->GetCount(serie) - 1; n++) {
         double x0 = dataset->GetX(n, serie);
         double y0 = dataset->GetY(n, serie);
@@ -27,12 +27,26 @@ bool XYPlot::AcceptDataset(Dataset *dataset)
     return (wxDynamicCast(dataset, XYDataset) != NULL);
 }
 
-void XYPlot::DrawDatasets(wxDC &dc, wxRect rc)
+void XYPlot::DrawDataset(wxDC &dc, wxRect rc, Dataset *dataset)
 {
-    for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
-        XYDataset *dataset = (XYDataset *) GetDataset(nData);
-        DrawXYDataset(dc, rc, dataset);
-    }
+    DrawXYDataset(dc, rc, (XYDataset *) dataset);
+}
+
+bool XYPlot::CanRasterizeDataset(Dataset *dataset)
+{
+    XYDataset *xyDataset = (XYDataset *) dataset;
+    XYRenderer *renderer = xyDataset->GetRenderer();
+
+    return renderer != NULL && GetDatasetVerticalAxis(dataset) != NULL
+            && GetDatasetHorizontalAxis(dataset) != NULL && renderer->CanRasterize(xyDataset);
+}
+
+void XYPlot::RasterizeDataset(ChartRaster &raster, wxRect rc, Dataset *dataset)
+{
+    XYDataset *xyDataset = (XYDataset *) dataset;
+
+    xyDataset->GetRenderer()->Rasterize(raster, rc, GetDatasetHorizontalAxis(dataset),
+            GetDatasetVerticalAxis(dataset), xyDataset);
 }
 
 void XYPlot::DrawXYDataset(wxDC &dc, wxRect rc, XYDataset *dataset)
@@ -0,0 +1,233 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xyrangeindex.cpp
+// Purpose: range minimum/maximum index implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/xy/xyrangeindex.h>
+
+XYRangeIndex::XYRangeIndex(size_t blockSize)
+{
+    m_blockSize = wxMax(blockSize, (size_t) 1);
+    m_base = 0;
+}
+
+XYRangeIndex::~XYRangeIndex()
+{
+}
+
+void XYRangeIndex::Truncate(size_t first)
+{
+    if (first == 0) {
+        m_minValues.clear();
+        m_maxValues.clear();
+        m_base = 0;
+        return ;
+    }
+
+    size_t blockCount = (m_base + first) / m_blockSize;
+
+    for (size_t level = 0; level < m_minValues.size(); level++) {
+        size_t size = blockCount >> level;
+
+        if (m_minValues[level].size() > size) {
+            m_minValues[level].resize(size);
+            m_maxValues[level].resize(size);
+        }
+    }
+}
+
+void XYRangeIndex::RemoveFront(size_t count)
+{
+    m_base += count;
+
+    size_t removed = m_base / m_blockSize;
+    size_t indexed = m_minValues.empty() ? 0 : m_minValues[0].size();
+
+    if (removed >= indexed) {
+        // no summaries of remaining points
+        m_minValues.clear();
+        m_maxValues.clear();
+        m_base -= removed * m_blockSize;
+    }
+    else if (removed * 2 >= indexed) {
+        // release summaries of removed points, when they take at least
+        // half of index, so rebuild cost is paid by removed blocks
+        m_minValues[0].erase(m_minValues[0].begin(), m_minValues[0].begin() + removed);
+        m_maxValues[0].erase(m_maxValues[0].begin(), m_maxValues[0].begin() + removed);
+        m_base -= removed * m_blockSize;
+
+        Rebuild();
+    }
+}
+
+void XYRangeIndex::Update(XYDataset *dataset, size_t serie)
+{
+    size_t blockCount = (m_base + dataset->GetCount(serie)) / m_blockSize;
+    size_t indexed = m_minValues.empty() ? 0 : m_minValues[0].size();
+
+    if (indexed > blockCount) {
+        // serie was shortened without notification
+        Truncate(0);
+        blockCount = dataset->GetCount(serie) / m_blockSize;
+        indexed = 0;
+    }
+
+    if (m_buffer.size() < m_blockSize) {
+        m_buffer.resize(m_blockSize);
+    }
+
+    for (size_t block = indexed; block < blockCount; block++) {
+        // first block can be partially removed
+        size_t start = wxMax(block * m_blockSize, m_base);
+        size_t count = (block + 1) * m_blockSize - start;
+
+        double *ys = &m_buffer[0];
+        dataset->GetXYBlock(serie, start - m_base, count, NULL, ys);
+
+        double minValue = ys[0];
+        double maxValue = ys[0];
+        for (size_t n = 1; n < count; n++) {
+            minValue = wxMin(minValue, ys[n]);
+            maxValue = wxMax(maxValue, ys[n]);
+        }
+
+        AddBlock(minValue, maxValue);
+    }
+}
+
+bool XYRangeIndex::GetMinMax(XYDataset *dataset, size_t serie, size_t first, size_t last,
+        double &minValue, double &maxValue)
+{
+    size_t count = dataset->GetCount(serie);
+    if (count == 0 || first > last || first >= count) {
+        return false;
+    }
+    last = wxMin(last, count - 1);
+
+    Update(dataset, serie);
+
+    bool hasValues = false;
+    size_t indexed = m_minValues.empty() ? 0 : m_minValues[0].size();
+
+    // whole blocks inside range, removed points are before
+    // first point, so blocks with their summaries are not used
+    size_t begin = m_base + first;
+    size_t end = m_base + last + 1;
+    size_t blockFirst = (begin + m_blockSize - 1) / m_blockSize;
+    size_t blockEnd = wxMin(end / m_blockSize, indexed);
+
+    if (blockFirst >= blockEnd) {
+        ScanPoints(dataset, serie, first, last - first + 1, minValue, maxValue, hasValues);
+        return hasValues;
+    }
+
+    // points before first whole block and after last one
+    ScanPoints(dataset, serie, first, blockFirst * m_blockSize - begin, minValue, maxValue, hasValues);
+    ScanPoints(dataset, serie, blockEnd * m_blockSize - m_base, end - blockEnd * m_blockSize, minValue, maxValue, hasValues);
+
+    // walk tree levels from bottom, taking summaries at range edges
+    size_t lo = blockFirst;
+    size_t hi = blockEnd;
+    for (size_t level = 0; lo < hi; level++) {
+        if (lo & 1) {
+            double minV = m_minValues[level][lo];
+            double maxV = m_maxValues[level][lo];
+
+            minValue = hasValues ? wxMin(minValue, minV) : minV;
+            maxValue = hasValues ? wxMax(maxValue, maxV) : maxV;
+            hasValues = true;
+            lo++;
+        }
+        if (hi & 1) {
+            hi--;
+
+            double minV = m_minValues[level][hi];
+            double maxV = m_maxValues[level][hi];
+
+            minValue = hasValues ? wxMin(minValue, minV) : minV;
+            maxValue = hasValues ? wxMax(maxValue, maxV) : maxV;
+            hasValues = true;
+        }
+        lo >>= 1;
+        hi >>= 1;
+    }
+    return hasValues;
+}
+
+void XYRangeIndex::AddBlock(double minValue, double maxValue)
+{
+    if (m_minValues.empty()) {
+        m_minValues.push_back(wxVector<double>());
+        m_maxValues.push_back(wxVector<double>());
+    }
+
+    m_minValues[0].push_back(minValue);
+    m_maxValues[0].push_back(maxValue);
+
+    // complete summaries of upper levels, that have both children now
+    for (size_t level = 1; m_minValues[level - 1].size() >= 2; level++) {
+        if (level == m_minValues.size()) {
+            m_minValues.push_back(wxVector<double>());
+            m_maxValues.push_back(wxVector<double>());
+        }
+
+        const wxVector<double> &childMin = m_minValues[level - 1];
+        const wxVector<double> &childMax = m_maxValues[level - 1];
+        size_t size = childMin.size() / 2;
+
+        if (m_minValues[level].size() == size) {
+            break;
+        }
+
+        m_minValues[level].push_back(wxMin(childMin[2 * size - 2], childMin[2 * size - 1]));
+        m_maxValues[level].push_back(wxMax(childMax[2 * size - 2], childMax[2 * size - 1]));
+    }
+}
+
+void XYRangeIndex::Rebuild()
+{
+    wxVector<double> minValues;
+    wxVector<double> maxValues;
+
+    minValues.swap(m_minValues[0]);
+    maxValues.swap(m_maxValues[0]);
+    m_minValues.clear();
+    m_maxValues.clear();
+
+    for (size_t n = 0; n < minValues.size(); n++) {
+        AddBlock(minValues[n], maxValues[n]);
+    }
+}
+
+void XYRangeIndex::ScanPoints(XYDataset *dataset, size_t serie, size_t first, size_t count,
+        double &minValue, double &maxValue, bool &hasValues)
+{
+    while (count != 0) {
+        size_t n = wxMin(count, m_blockSize);
+
+        if (m_buffer.size() < n) {
+            m_buffer.resize(m_blockSize);
+        }
+
+        double *ys = &m_buffer[0];
+        dataset->GetXYBlock(serie, first, n, NULL, ys);
+
+        for (size_t i = 0; i < n; i++) {
+            if (!hasValues) {
+                minValue = maxValue = ys[i];
+                hasValues = true;
+            }
+            else {
+                minValue = wxMin(minValue, ys[i]);
+                maxValue = wxMax(maxValue, ys[i]);
+            }
+        }
+
+        first += n;
+        count -= n;
+    }
+}
@@ -9,6 +9,9 @@
 
 #include <wx/xy/xyrenderer.h>
 
+// pixels added to each side of clipping box, when visible range is found
+#define VISIBLE_RANGE_CLIP_MARGIN 16
+
 IMPLEMENT_CLASS(XYRenderer, Renderer)
 
 XYRenderer::XYRenderer()
@@ -18,3 +21,150 @@ XYRenderer::XYRenderer()
 XYRenderer::~XYRenderer()
 {
 }
+
+bool XYRenderer::CanRasterize(XYDataset *WXUNUSED(dataset))
+{
+    return false;
+}
+
+void XYRenderer::Rasterize(ChartRaster &WXUNUSED(raster), wxRect WXUNUSED(rc), Axis *WXUNUSED(horizAxis),
+        Axis *WXUNUSED(vertAxis), XYDataset *WXUNUSED(dataset))
+{
+    // default - do nothing
+}
+
+bool XYRenderer::GetVisibleRange(wxDC &dc, const AxisTransform &horizTransform, Axis *horizAxis,
+        XYDataset *dataset, size_t serie, size_t &first, size_t &count, size_t extra)
+{
+    wxCoord clipX, clipY, clipWidth, clipHeight;
+    dc.GetClippingBox(&clipX, &clipY, &clipWidth, &clipHeight);
+
+    return GetVisibleRange(wxRect(clipX, clipY, clipWidth, clipHeight), horizTransform, horizAxis,
+            dataset, serie, first, count, extra);
+}
+
+bool XYRenderer::GetVisibleRange(const wxRect &clip, const AxisTransform &horizTransform, Axis *horizAxis,
+        XYDataset *dataset, size_t serie, size_t &first, size_t &count, size_t extra)
+{
+    size_t total = dataset->GetCount(serie);
+
+    if (!dataset->IsXSorted(serie)) {
+        first = 0;
+        count = total;
+        return total != 0;
+    }
+
+    double minValue, maxValue;
+    horizAxis->GetVisibleBounds(minValue, maxValue);
+
+    // narrow range to clipping box, widened by margin for symbols and wide
+    // pens of points just outside of it
+    if (clip.width > 0 && horizTransform.GetScale() != 0 && !horizTransform.HasValueMap()) {
+        double clipMin = horizTransform.ToData(clip.x - VISIBLE_RANGE_CLIP_MARGIN);
+        double clipMax = horizTransform.ToData(clip.x + clip.width + VISIBLE_RANGE_CLIP_MARGIN);
+
+        minValue = wxMax(minValue, wxMin(clipMin, clipMax));
+        maxValue = wxMin(maxValue, wxMax(clipMin, clipMax));
+    }
+
+    size_t begin = dataset->FindXIndex(serie, minValue, false);
+    size_t end = dataset->FindXIndex(serie, maxValue, true);
+
+    begin = (begin > extra) ? begin - extra : 0;
+    end = wxMin(end + extra, total);
+    if (begin >= end) {
+        return false;
+    }
+
+    first = begin;
+    count = end - begin;
+    return true;
+}
+
+//
+// XYLinePoints
+//
+
+XYLinePoints::XYLinePoints(bool decimate)
+{
+    m_decimate = decimate;
+    m_hasColumn = false;
+    m_columnCount = 0;
+    m_minIndex = 0;
+    m_maxIndex = 0;
+}
+
+XYLinePoints::~XYLinePoints()
+{
+}
+
+void XYLinePoints::Clear(size_t sizeHint)
+{
+    m_points.clear();
+    m_points.reserve(sizeHint);
+    m_hasColumn = false;
+    m_columnCount = 0;
+}
+
+void XYLinePoints::Add(const wxPoint &pt)
+{
+    if (!m_decimate) {
+        Append(pt);
+        return ;
+    }
+
+    if (m_hasColumn && pt.x != m_first.x) {
+        FlushColumn();
+    }
+
+    if (!m_hasColumn) {
+        m_hasColumn = true;
+        m_first = m_min = m_max = pt;
+        m_minIndex = m_maxIndex = 0;
+        m_columnCount = 0;
+    }
+    else {
+        if (pt.y < m_min.y) {
+            m_min = pt;
+            m_minIndex = m_columnCount;
+        }
+        if (pt.y > m_max.y) {
+            m_max = pt;
+            m_maxIndex = m_columnCount;
+        }
+    }
+    m_last = pt;
+    m_columnCount++;
+}
+
+std::vector<wxPoint> &XYLinePoints::GetPoints()
+{
+    if (m_hasColumn) {
+        FlushColumn();
+    }
+    return m_points;
+}
+
+void XYLinePoints::Append(const wxPoint &pt)
+{
+    if (m_points.empty() || m_points.back() != pt) {
+        m_points.push_back(pt);
+    }
+}
+
+void XYLinePoints::FlushColumn()
+{
+    // keep original order of minimal and maximal points
+    Append(m_first);
+    if (m_minIndex < m_maxIndex) {
+        Append(m_min);
+        Append(m_max);
+    }
+    else {
+        Append(m_max);
+        Append(m_min);
+    }
+    Append(m_last);
+
+    m_hasColumn = false;
+}
@@ -0,0 +1,445 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:    xyringbufferdataset.cpp
+// Purpose: xy ring buffer serie and dataset implementation
+// Author:    wxFreeChart team
+// Created:    2026/10/17
+// Copyright:    (c) 2026 wxFreeChart team
+// Licence:    wxWidgets licence
+/////////////////////////////////////////////////////////////////////////////
+
+#include <wx/xy/xyringbufferdataset.h>
+#include <wx/axis/axis.h>
+
+IMPLEMENT_CLASS(XYRingBufferSerie, wxObject)
+IMPLEMENT_CLASS(XYRingBufferDataset, XYDataset)
+
+//
+// XYRingBufferSerie
+//
+
+XYRingBufferSerie::XYRingBufferSerie(size_t capacity)
+: m_xs(capacity), m_ys(capacity)
+{
+    m_dataset = NULL;
+    m_head = 0;
+    m_count = 0;
+    m_retention = 0;
+    m_xSorted = true;
+}
+
+XYRingBufferSerie::~XYRingBufferSerie()
+{
+}
+
+void XYRingBufferSerie::SetCapacity(size_t capacity)
+{
+    if (capacity == m_xs.size()) {
+        return ;
+    }
+
+    size_t count = wxMin(m_count, capacity);
+    size_t removed = m_count - count;
+    wxVector<double> xs(capacity);
+    wxVector<double> ys(capacity);
+
+    // keep newest points, unwrapped to the start of new buffer
+    CopyValues(m_count - count, count, count ? &xs[0] : NULL, count ? &ys[0] : NULL);
+
+    m_xs.swap(xs);
+    m_ys.swap(ys);
+    m_head = 0;
+    m_count = count;
+
+    // kept points have same logical indexes, after removed ones
+    if (m_dataset != NULL && removed != 0) {
+        m_dataset->InvalidateBounds(BOUNDS_X);
+        m_dataset->InvalidateBounds(BOUNDS_Y);
+        m_dataset->PointsChanged(this, removed, 0);
+    }
+}
+
+void XYRingBufferSerie::SetRetention(double span)
+{
+    wxCHECK_RET(span >= 0, wxT("XYRingBufferSerie::SetRetention"));
+
+    m_retention = span;
+
+    if (m_retention > 0 && m_count > 1) {
+        double minX = GetX(m_count - 1) - m_retention;
+        size_t evicted = 0;
+
+        while (m_count > 1 && GetX(0) < minX) {
+            EvictOldest();
+            evicted++;
+        }
+
+        if (evicted != 0 && m_dataset != NULL) {
+            m_dataset->PointsChanged(this, evicted, 0);
+        }
+    }
+}
+
+void XYRingBufferSerie::Append(double x, double y)
+{
+    if (m_xs.empty()) {
+        return ;
+    }
+
+    size_t evicted = 0;
+
+    Push(x, y, evicted);
+    PointsAppended(1, evicted);
+}
+
+void XYRingBufferSerie::Append(const double *xs, const double *ys, size_t count)
+{
+    if (count == 0 || m_xs.empty()) {
+        return ;
+    }
+
+    size_t evicted = 0;
+
+    for (size_t n = 0; n < count; n++) {
+        Push(xs[n], ys[n], evicted);
+    }
+    PointsAppended(count, evicted);
+}
+
+void XYRingBufferSerie::Clear()
+{
+    m_head = 0;
+    m_count = 0;
+    m_xSorted = true;
+
+    if (m_dataset != NULL) {
+        m_dataset->DatasetChanged(DatasetChange(DATASET_CHANGE_CLEAR, m_dataset->GetSerieIndex(this)));
+        m_dataset->UpdateWindowAxis();
+    }
+}
+
+void XYRingBufferSerie::SetName(const wxString &name)
+{
+    m_name = name;
+
+    if (m_dataset != NULL) {
+        m_dataset->DatasetChanged(DatasetChange(DATASET_CHANGE_RENAME, m_dataset->GetSerieIndex(this)), false);
+    }
+}
+
+void XYRingBufferSerie::CopyValues(size_t first, size_t count, double *xs, double *ys) const
+{
+    if (count == 0) {
+        return ;
+    }
+
+    // logical range maps to at most two physical parts
+    size_t start = Physical(first);
+    size_t part = wxMin(count, m_xs.size() - start);
+
+    if (xs != NULL) {
+        memcpy(xs, &m_xs[start], part * sizeof(double));
+        if (part < count) {
+            memcpy(xs + part, &m_xs[0], (count - part) * sizeof(double));
+        }
+    }
+    if (ys != NULL) {
+        memcpy(ys, &m_ys[start], part * sizeof(double));
+        if (part < count) {
+            memcpy(ys + part, &m_ys[0], (count - part) * sizeof(double));
+        }
+    }
+}
+
+void XYRingBufferSerie::Push(double x, double y, size_t &evicted)
+{
+    if (m_count == m_xs.size()) {
+        EvictOldest();
+        evicted++;
+    }
+
+    if (m_count != 0 && x < GetX(m_count - 1)) {
+        m_xSorted = false;
+    }
+
+    size_t pos = Physical(m_count);
+    m_xs[pos] = x;
+    m_ys[pos] = y;
+    m_count++;
+
+    if (m_dataset != NULL) {
+        m_dataset->ExtendBounds(BOUNDS_X, x);
+        m_dataset->ExtendBounds(BOUNDS_Y, y);
+    }
+
+    if (m_retention > 0) {
+        double minX = x - m_retention;
+
+        while (m_count > 1 && GetX(0) < minX) {
+            EvictOldest();
+            evicted++;
+        }
+    }
+}
+
+void XYRingBufferSerie::EvictOldest()
+{
+    if (m_dataset != NULL) {
+        // bounds need rescan only if evicted point was an extreme
+        m_dataset->ValueRemoved(BOUNDS_X, m_xs[m_head]);
+        m_dataset->ValueRemoved(BOUNDS_Y, m_ys[m_head]);
+    }
+
+    m_head = Physical(1);
+    m_count--;
+
+    if (m_count == 0) {
+        m_head = 0;
+        m_xSorted = true;
+    }
+}
+
+void XYRingBufferSerie::PointsAppended(size_t count, size_t evicted)
+{
+    if (m_dataset == NULL) {
+        return ;
+    }
+
+    // points, that were appended and evicted in same call, are not reported
+    size_t appended = wxMin(count, m_count);
+    m_dataset->PointsChanged(this, evicted - (count - appended), appended);
+}
+
+//
+// XYRingBufferDataset
+//
+
+XYRingBufferDataset::XYRingBufferDataset()
+{
+    m_windowAxis = NULL;
+    m_winWidth = 0;
+
+    // y bounds are found in O(log N), when extreme point is evicted
+    SetUseRangeIndex(true);
+}
+
+XYRingBufferDataset::~XYRingBufferDataset()
+{
+    SAFE_REMOVE_OBSERVER(this, m_windowAxis);
+
+    for (size_t n = 0; n < m_series.size(); n++) {
+        wxDELETE(m_series[n]);
+    }
+}
+
+void XYRingBufferDataset::AddSerie(XYRingBufferSerie *serie)
+{
+    wxCHECK_RET(serie != NULL && serie->m_dataset == NULL, wxT("XYRingBufferDataset::AddSerie"));
+
+    serie->m_dataset = this;
+    m_series.push_back(serie);
+    DatasetChanged();
+}
+
+size_t XYRingBufferDataset::GetSerieIndex(XYRingBufferSerie *serie)
+{
+    size_t index = 0;
+    while (index < m_series.size() && m_series[index] != serie) {
+        index++;
+    }
+    return index;
+}
+
+XYRingBufferSerie *XYRingBufferDataset::GetSerie(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), NULL);
+    return m_series[serie];
+}
+
+void XYRingBufferDataset::SetWindowAxis(Axis *axis, double winWidth)
+{
+    SAFE_REPLACE_OBSERVER(this, m_windowAxis, axis);
+    m_windowAxis = axis;
+    m_winWidth = winWidth;
+
+    if (m_windowAxis != NULL) {
+        m_windowAxis->SetUseWindow(true);
+        UpdateWindowAxis();
+    }
+}
+
+size_t XYRingBufferDataset::GetSerieCount()
+{
+    return m_series.size();
+}
+
+wxString XYRingBufferDataset::GetSerieName(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), wxEmptyString);
+    return m_series[serie]->GetName();
+}
+
+size_t XYRingBufferDataset::GetCount(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), 0);
+    return m_series[serie]->GetCount();
+}
+
+double XYRingBufferDataset::GetX(size_t index, size_t serie)
+{
+    wxCHECK(serie < m_series.size(), 0);
+    return m_series[serie]->GetX(index);
+}
+
+double XYRingBufferDataset::GetY(size_t index, size_t serie)
+{
+    wxCHECK(serie < m_series.size(), 0);
+    return m_series[serie]->GetY(index);
+}
+
+void XYRingBufferDataset::GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys)
+{
+    wxCHECK_RET(serie < m_series.size(), wxT("XYRingBufferDataset::GetXYBlock"));
+
+    XYRingBufferSerie *s = m_series[serie];
+    wxCHECK_RET(first + count <= s->m_count, wxT("XYRingBufferDataset::GetXYBlock"));
+
+    s->CopyValues(first, count, xs, ys);
+}
+
+const double *XYRingBufferDataset::GetXColumn(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), NULL);
+
+    // points are contiguous only while buffer is not wrapped
+    XYRingBufferSerie *s = m_series[serie];
+    if (s->m_count == 0 || s->m_head + s->m_count > s->m_xs.size()) {
+        return NULL;
+    }
+    return &s->m_xs[s->m_head];
+}
+
+const double *XYRingBufferDataset::GetYColumn(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), NULL);
+
+    XYRingBufferSerie *s = m_series[serie];
+    if (s->m_count == 0 || s->m_head + s->m_count > s->m_ys.size()) {
+        return NULL;
+    }
+    return &s->m_ys[s->m_head];
+}
+
+bool XYRingBufferDataset::IsXSorted(size_t serie)
+{
+    wxCHECK(serie < m_series.size(), false);
+    return m_series[serie]->m_xSorted;
+}
+
+bool XYRingBufferDataset::CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue)
+{
+    if (dim == BOUNDS_Y && GetUseRangeIndex()) {
+        return XYDataset::CalcBounds(dim, minValue, maxValue);
+    }
+
+    bool hasValues = false;
+
+    for (size_t serie = 0; serie < m_series.size(); serie++) {
+        XYRingBufferSerie *s = m_series[serie];
+        if (s->m_count == 0) {
+            continue;
+        }
+
+        if (dim == BOUNDS_X && s->m_xSorted) {
+            // oldest and newest points are x extremes, so eviction costs O(1)
+            double x0 = s->GetX(0);
+            double x1 = s->GetX(s->m_count - 1);
+
+            if (!hasValues) {
+                minValue = x0;
+                maxValue = x1;
+                hasValues = true;
+            }
+            else {
+                minValue = wxMin(minValue, x0);
+                maxValue = wxMax(maxValue, x1);
+            }
+            continue;
+        }
+
+        const wxVector<double> &values = (dim == BOUNDS_X) ? s->m_xs : s->m_ys;
+        for (size_t n = 0; n < s->m_count; n++) {
+            double v = values[s->Physical(n)];
+
+            if (!hasValues) {
+                minValue = maxValue = v;
+                hasValues = true;
+            }
+            else {
+                minValue = wxMin(minValue, v);
+                maxValue = wxMax(maxValue, v);
+            }
+        }
+    }
+    return hasValues;
+}
+
+void XYRingBufferDataset::PointsChanged(XYRingBufferSerie *serie, size_t removed, size_t appended)
+{
+    size_t index = GetSerieIndex(serie);
+
+    {
+        // eviction and append are reported as one batch, so observers
+        // update axes once, when append is reported
+        DatasetUpdateLocker locker(this);
+
+        // eviction is reported as removal from serie start, so observers
+        // can scroll, and range index keeps summaries of remaining points
+        if (removed != 0) {
+            RemoveRangeIndexFront(index, removed);
+            DatasetChanged(DatasetChange(DATASET_CHANGE_REMOVE, index, 0, removed), false);
+        }
+        if (appended != 0) {
+            DatasetChanged(DatasetChange(DATASET_CHANGE_APPEND, index, serie->GetCount() - appended, appended), false);
+        }
+    }
+    UpdateWindowAxis();
+}
+
+void XYRingBufferDataset::AxisChanged(Axis *WXUNUSED(axis))
+{
+}
+
+void XYRingBufferDataset::BoundsChanged(Axis *WXUNUSED(axis))
+{
+}
+
+void XYRingBufferDataset::AxisDestroyed(Axis *axis)
+{
+    if (m_windowAxis == axis) {
+        m_windowAxis = NULL;
+    }
+}
+
+void XYRingBufferDataset::UpdateWindowAxis()
+{
+    if (m_windowAxis == NULL) {
+        return ;
+    }
+
+    double minX = GetMinX();
+    double maxX = GetMaxX();
+    double winWidth = m_winWidth;
+
+    if (winWidth == 0) {
+        for (size_t n = 0; n < m_series.size(); n++) {
+            winWidth = wxMax(winWidth, m_series[n]->GetRetention());
+        }
+    }
+    if (winWidth == 0) {
+        winWidth = maxX - minX;
+    }
+
+    if (winWidth > 0) {
+        m_windowAxis->SetWindow(maxX - winWidth, winWidth);
+    }
+}
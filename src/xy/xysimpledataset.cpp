@@ -45,6 +45,25 @@ double XYSerie::GetY(size_t index)
     return m_newdata.at(index).y;
 }
 
+void XYSerie::GetValues(size_t first, size_t count, double *xs, double *ys)
+{
+    wxCHECK_RET(first + count <= m_newdata.size(), wxT("XYSerie::GetValues"));
+
+    if (count == 0) {
+        return ; // serie can be empty, so first point may not exist
+    }
+
+    const wxRealPoint *pts = &m_newdata[0] + first;
+    for (size_t n = 0; n < count; n++) {
+        if (xs != NULL) {
+            xs[n] = pts[n].x;
+        }
+        if (ys != NULL) {
+            ys[n] = pts[n].y;
+        }
+    }
+}
+
 void XYSerie::UpdateX(size_t index, double x)
 {
     m_newdata.at(index).x = x;
@@ -135,6 +154,12 @@ double XYSimpleDataset::GetY(size_t index, size_t serie)
     return m_series[serie]->GetY(index);
 }
 
+void XYSimpleDataset::GetXYBlock(size_t serie, size_t first, size_t count, double *xs, double *ys)
+{
+    wxCHECK_RET(serie < m_series.Count(), wxT("XYSimpleDataset::GetXYBlock"));
+    m_series[serie]->GetValues(first, count, xs, ys);
+}
+
 size_t XYSimpleDataset::GetSerieCount()
 {
     return m_series.Count();
@@ -154,5 +179,5 @@ wxString XYSimpleDataset::GetSerieName(size_t serie)
 void XYSimpleDataset::SetSerieName(size_t serie, const wxString &name)
 {
     m_series[serie]->SetName(name);
-    DatasetChanged();
+    DatasetChanged(DatasetChange(DATASET_CHANGE_RENAME, serie), false);
 }
@@ -30,19 +30,17 @@ bool BubblePlot::AcceptDataset(Dataset *dataset)
     return (wxDynamicCast(dataset, XYZDataset) != NULL);
 }
 
-void BubblePlot::DrawDatasets(wxDC &dc, wxRect rc)
+void BubblePlot::DrawDataset(wxDC &dc, wxRect rc, Dataset *dataset)
 {
-    for (size_t nData = 0; nData < GetDatasetCount(); nData++) {
-        XYZDataset *dataset = (XYZDataset *) GetDataset(nData);
-        XYZRenderer *renderer = dataset->GetRenderer();
-        wxCHECK_RET(renderer != NULL, wxT("no renderer for data"));
+    XYZDataset *xyzDataset = (XYZDataset *) dataset;
+    XYZRenderer *renderer = xyzDataset->GetRenderer();
+    wxCHECK_RET(renderer != NULL, wxT("no renderer for data"));
 
-        Axis *vertAxis = GetDatasetVerticalAxis(dataset);
-        Axis *horizAxis = GetDatasetHorizontalAxis(dataset);
+    Axis *vertAxis = GetDatasetVerticalAxis(dataset);
+    Axis *horizAxis = GetDatasetHorizontalAxis(dataset);
 
-        wxCHECK_RET(vertAxis != NULL, wxT("no axis for data"));
-        wxCHECK_RET(horizAxis != NULL, wxT("no axis for data"));
+    wxCHECK_RET(vertAxis != NULL, wxT("no axis for data"));
+    wxCHECK_RET(horizAxis != NULL, wxT("no axis for data"));
 
-        renderer->Draw(dc, rc, horizAxis, vertAxis, dataset);
-    }
+    renderer->Draw(dc, rc, horizAxis, vertAxis, xyzDataset);
 }
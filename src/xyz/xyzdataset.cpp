@@ -19,32 +19,45 @@ XYZDataset::~XYZDataset()
 
 double XYZDataset::GetMinZ()
 {
-    double minZ = 0;
+    double minZ, maxZ;
 
-    for (size_t serie = 0; serie < GetSerieCount(); serie++) {
-        for (size_t n = 0; n < GetCount(serie); n++) {
-            double z = GetZ(n, serie);
-            if (n == 0 && serie == 0)
-                minZ = z;
-            else
-                minZ = wxMin(minZ, z);
-        }
+    if (!GetBounds(BOUNDS_Z, minZ, maxZ)) {
+        return 0;
     }
     return minZ;
 }
 
 double XYZDataset::GetMaxZ()
 {
-    double maxZ = 0;
+    double minZ, maxZ;
+
+    if (!GetBounds(BOUNDS_Z, minZ, maxZ)) {
+        return 0;
+    }
+    return maxZ;
+}
+
+bool XYZDataset::CalcBounds(BOUNDS_DIMENSION dim, double &minValue, double &maxValue)
+{
+    if (dim != BOUNDS_Z) {
+        return XYDataset::CalcBounds(dim, minValue, maxValue);
+    }
+
+    bool hasValues = false;
 
     for (size_t serie = 0; serie < GetSerieCount(); serie++) {
         for (size_t n = 0; n < GetCount(serie); n++) {
             double z = GetZ(n, serie);
-            if (n == 0 && serie == 0)
-                maxZ = z;
-            else
-                maxZ = wxMax(maxZ, z);
+
+            if (!hasValues) {
+                minValue = maxValue = z;
+                hasValues = true;
+            }
+            else {
+                minValue = wxMin(minValue, z);
+                maxValue = wxMax(maxValue, z);
+            }
         }
     }
-    return maxZ;
+    return hasValues;
 }
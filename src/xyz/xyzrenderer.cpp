@@ -33,26 +33,26 @@ void XYZRenderer::Draw(wxDC &dc, wxRect rc, Axis *horizAxis, Axis *vertAxis, XYZ
 
     double k = (m_maxRad - m_minRad) / (maxZ - minZ);
 
+    XYDataBlock block;
+
+    AxisTransform horizTransform = horizAxis->GetTransform(rc.x, rc.width);
+    AxisTransform vertTransform = vertAxis->GetTransform(rc.y, rc.height);
 
     FOREACH_SERIE(serie, dataset) {
         dc.SetPen(*GetSeriePen(serie));
         dc.SetBrush(*GetSerieBrush(serie));
 
-        FOREACH_DATAITEM(n, serie, dataset) {
-            double xVal;
-            double yVal;
-            double zVal;
-
-            xVal = dataset->GetX(n, serie);
-            yVal = dataset->GetY(n, serie);
-            zVal = dataset->GetZ(n, serie);
+        block.Load(dataset, serie);
+        block.ToGraphics(horizTransform, vertTransform);
+        const wxCoord *xgs = block.GetXCoords();
+        const wxCoord *ygs = block.GetYCoords();
 
-            wxCoord x = horizAxis->ToGraphics(dc, rc.x, rc.width, xVal);
-            wxCoord y = vertAxis->ToGraphics(dc, rc.y, rc.height, yVal);
+        for (size_t n = 0; n < block.GetCount(); n++) {
+            double zVal = dataset->GetZ(n, serie);
 
             wxCoord r = (wxCoord) ((zVal - minZ) * k + m_minRad);
 
-            dc.DrawCircle(x, y, r);
+            dc.DrawCircle(xgs[n], ygs[n], r);
         }
     }
 }
@@ -65,8 +65,8 @@ void XYZRenderer::SetSeriePen(size_t serie, wxPen *pen)
 
 void XYZRenderer::SetSerieColor(size_t serie, wxColour *color)
 {
-    SetSeriePen(serie, wxThePenList->FindOrCreatePen(*color, m_defaultPenWidth, m_defaultPenStyle));
-    SetSerieBrush(serie, wxTheBrushList->FindOrCreateBrush(*color, m_defaultBrushStyle));
+    SetSeriePen(serie, DrawResources::FindOrCreatePen(*color, m_defaultPenWidth, m_defaultPenStyle));
+    SetSerieBrush(serie, DrawResources::FindOrCreateBrush(*color, m_defaultBrushStyle));
 }
 
 wxColour XYZRenderer::GetSerieColor(size_t serie)
@@ -80,7 +80,7 @@ wxColour XYZRenderer::GetSerieColor(size_t serie)
 wxPen *XYZRenderer::GetSeriePen(size_t serie)
 {
     if (m_seriePens.find(serie) == m_seriePens.end()) {
-        return wxThePenList->FindOrCreatePen(GetDefaultColour(serie), m_defaultPenWidth, m_defaultPenStyle);
+        return DrawResources::FindOrCreatePen(GetDefaultColour(serie), m_defaultPenWidth, m_defaultPenStyle);
     }
     return &m_seriePens[serie];
 }
@@ -94,7 +94,7 @@ void XYZRenderer::SetSerieBrush(size_t serie, wxBrush *brush)
 wxBrush *XYZRenderer::GetSerieBrush(size_t serie)
 {
     if (m_serieBrushs.find(serie) == m_serieBrushs.end()) {
-        return wxTheBrushList->FindOrCreateBrush(GetDefaultColour(serie), m_defaultBrushStyle);
+        return DrawResources::FindOrCreateBrush(GetDefaultColour(serie), m_defaultBrushStyle);
     }
     return &m_serieBrushs[serie];
 }